@@ -54,13 +54,95 @@
     #define RUKEN_MULTITHREAD_STATUS_STR "Disabled"
 #endif
 
+// Initial capacity of the work stealing deque of every scheduler worker, deques grow if needed.
+// Must be a power of 2
+#define RUKEN_SCHEDULER_DEQUE_CAPACITY 1024ULL
+
+// Number of preallocated jobs per scheduler worker (and for the jobs scheduled from outside of the workers).
+// Jobs are only allocated on the heap if more than this number of jobs are in flight at once
+#define RUKEN_JOB_POOL_CAPACITY 4096ULL
+
+// Number of busy pooled jobs skipped before falling back on a heap allocation
+#define RUKEN_JOB_POOL_PROBE_COUNT 8ULL
+
+// Default maximum number of workers executing background jobs (see EJobPriority) at once.
+// The other workers always stay available for frame critical work
+#define RUKEN_SCHEDULER_MAX_BACKGROUND_WORKERS 2ULL
+
+// Default idle strategy of the scheduler workers: number of spin iterations, then number of yields,
+// before parking until a job is scheduled. Higher values lower the wake up latency at the cost of power
+// (see Scheduler::SetIdleSpinBudget)
+#define RUKEN_SCHEDULER_IDLE_SPIN_COUNT  256U
+#define RUKEN_SCHEDULER_IDLE_YIELD_COUNT 16U
+
+// Number of frames between 2 statistics summaries logged by the scheduler, statistics are reset after each summary.
+// Set to 0 to disable the periodic summary, statistics are still available through Scheduler::GetStatistics.
+#define RUKEN_SCHEDULER_STATISTICS_LOG_PERIOD 3600ULL
+
+// Number of chunks per thread (workers and caller) used by the parallel algorithms splitting their work up front
+// (reductions, scans and sorts). More chunks means a better load balancing, but more merging work.
+#define RUKEN_PARALLEL_CHUNKS_PER_THREAD 4ULL
+
+// Ranges with less elements than this are sorted sequentially by ParallelSort
+#define RUKEN_PARALLEL_SORT_THRESHOLD 4096ULL
+
+// Number of chunks used by the parallel algorithms splitting their work up front when the scheduler is in deterministic mode,
+// replacing RUKEN_PARALLEL_CHUNKS_PER_THREAD so that results do not depend on the number of workers (see Scheduler::SetDeterministicMode)
+#define RUKEN_PARALLEL_DETERMINISTIC_CHUNKS_COUNT 64ULL
+
+// ------------------------------
+//           Simulation
+
+// Duration in seconds of a single simulation step, the simulation is always updated with this fixed timestep
+#define RUKEN_SIMULATION_FIXED_STEP (1.0 / 60.0)
+
+// Maximum number of simulation steps run per frame. If the simulation can't keep up,
+// the time left over is dropped and the simulation slows down instead of stalling the application
+#define RUKEN_SIMULATION_MAX_STEPS 5U
+
+// Maximum number of frames per second of the kernel loop, the kernel sleeps for the rest of the frame
+#define RUKEN_KERNEL_MAX_FRAME_RATE 240.0F
+
+// ------------------------------
+//           Rendering
+
+// Number of frames the render stage may lag behind the simulation, see FramePipeline.
+// 1 simulates and renders every frame serially, 2 renders frame N while frame N+1 is being simulated
+#define RUKEN_FRAME_PIPELINE_DEPTH 2U
+
+// Initial capacity in bytes of the storage of each render snapshot, snapshots grow on demand
+#define RUKEN_RENDER_SNAPSHOT_CAPACITY 65536ULL
+
+// ------------------------------
+//               IO
+
+// Number of entries of the io_uring submission queue, ie. maximum number of read chunks in flight (Linux only)
+#define RUKEN_IO_QUEUE_DEPTH 256U
+
+// Number of I/O threads used when io_uring is not available. These threads only wait on the disk
+#define RUKEN_IO_THREADS_COUNT 2ULL
+
+// Reads are split in chunks of at most this size, chunks of a same read are read in parallel.
+// Must be a multiple of RUKEN_IO_DIRECT_ALIGNMENT
+#define RUKEN_IO_MAX_CHUNK_SIZE (1ULL << 20ULL)
+
+// Alignment of the offsets, sizes and buffers of the reads of files opened for direct I/O (see File)
+#define RUKEN_IO_DIRECT_ALIGNMENT 4096ULL
+
 // ------------------------------
 //       Resource management
 
+// Interns the paths of the resource identifiers hashed at runtime, used for debug messages and collision detection
 #if defined(RUKEN_CONFIG_DEBUG)
-    #define RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER
+    #define RUKEN_RESOURCE_IDENTIFIER_INTERNING
 #endif
 
+// Number of shards of the resource manifest table, each shard has its own write lock. Must be a power of 2
+#define RUKEN_RESOURCE_MANIFEST_TABLE_SHARDS 64ULL
+
+// Initial number of slots of each shard of the resource manifest table. Must be a power of 2
+#define RUKEN_RESOURCE_MANIFEST_TABLE_SHARD_CAPACITY 16ULL
+
 // ------------------------------
 //              ECS
 
@@ -68,6 +150,21 @@
 // as low as possible. Must be a power of 2 with a minimum of 8.
 #define RUKEN_MAX_ECS_COMPONENTS 64
 
+// Number of rows reserved at once by a thread when creating entities concurrently.
+// Bigger blocks means less contention on the archetypes, but more unused rows between 2 synchronization points.
+#define RUKEN_ECS_RESERVATION_BLOCK_SIZE 64ULL
+
+// Number of simulation updates between 2 statistics summaries logged by the entity admins.
+// Set to 0 to disable the periodic summary, statistics are still available through EntityAdmin::GetArchetypesStatistics.
+#define RUKEN_ECS_STATISTICS_LOG_PERIOD 3600ULL
+
+// ------------------------------
+//            Memory
+
+// Initial capacity in bytes of the frame allocator of each thread (see FrameAllocator).
+// Allocators grow on demand, this only avoids some reallocations during the first frames.
+#define RUKEN_FRAME_ALLOCATOR_CAPACITY 262144ULL
+
 // ------------------------------
 //            Logging
 
@@ -77,4 +174,20 @@
 #else
     #define RUKEN_LOGGING_DISABLED
     #define RUKEN_LOGGING_STATUS_STR "Disabled"
-#endif
\ No newline at end of file
+#endif
+
+// ------------------------------
+//            Tracing
+
+// Tracing is still opt-in at runtime (see Tracer::Start), this only allows to strip it from the build entirely
+#if !defined(RUKEN_REQUEST_NO_TRACING_BUILD)
+    #define RUKEN_TRACING_ENABLED
+    #define RUKEN_TRACING_STATUS_STR "Enabled"
+#else
+    #define RUKEN_TRACING_DISABLED
+    #define RUKEN_TRACING_STATUS_STR "Disabled"
+#endif
+
+// Number of trace events kept per thread, older events are overwritten once the buffer of a thread is full.
+// Must be a power of 2
+#define RUKEN_TRACE_BUFFER_CAPACITY 65536ULL
\ No newline at end of file
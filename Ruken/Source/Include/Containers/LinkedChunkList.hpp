@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "Build/Namespace.hpp"
 #include "Types/FundamentalTypes.hpp"
 #include "Containers/LinkedChunkListNode.hpp"
@@ -35,6 +37,10 @@ BEGIN_RUKEN_NAMESPACE
  *        it contains multiple ones, by default 16Kb of them
  * \tparam TType Type to hold in every node
  * \tparam TChunkSize Size in octets of one chunk (default is 16Kb or 2046 octets)
+ *
+ * \note The list can grow while other threads are reading it: nodes are published with release semantics,
+ *       so any node returned by GetNode(), GetTail() or reached through next_node is fully constructed.
+ *       Only one thread at a time may create or delete nodes.
  */
 template<typename TType, RkSize TChunkSize = 2048>
 class LinkedChunkList
@@ -49,9 +55,9 @@ class LinkedChunkList
 
         #pragma region Members
 
-        Node*  m_head {nullptr};
-        Node*  m_tail {nullptr};
-        RkSize m_size {0ULL};
+        std::atomic<Node*>  m_head {nullptr};
+        std::atomic<Node*>  m_tail {nullptr};
+        std::atomic<RkSize> m_size {0ULL};
 
         #pragma endregion
 
@@ -60,8 +66,8 @@ class LinkedChunkList
         #pragma region Constructors
 
         LinkedChunkList()                               = default;
-        LinkedChunkList(LinkedChunkList const& in_copy) = default;
-        LinkedChunkList(LinkedChunkList&&      in_move) = default;
+        LinkedChunkList(LinkedChunkList const& in_copy) = delete;
+        LinkedChunkList(LinkedChunkList&&      in_move) = delete;
         ~LinkedChunkList();
 
         #pragma endregion
@@ -93,6 +99,7 @@ class LinkedChunkList
         /**
          * \brief Creates a new node at the end of the list
          * \return Reference onto the new node
+         * \note This can be called while other threads are reading the list, but not concurrently with itself or DeleteNode()
          */
         Node& CreateNode() noexcept;
 
@@ -108,6 +115,7 @@ class LinkedChunkList
          * \brief Finds a node at a given index and returns it
          * \param in_node_index Index of the node to return
          * \return Node or nullptr if the requested node does not exist
+         * \note This is safe to call while another thread is creating nodes
          */
         Node* GetNode(RkSize in_node_index) const noexcept;
 
@@ -123,8 +131,8 @@ class LinkedChunkList
 
         #pragma region Operators
 
-        LinkedChunkList& operator=(LinkedChunkList const& in_copy) = default;
-        LinkedChunkList& operator=(LinkedChunkList&&      in_move) = default;
+        LinkedChunkList& operator=(LinkedChunkList const& in_copy) = delete;
+        LinkedChunkList& operator=(LinkedChunkList&&      in_move) = delete;
 
         #pragma endregion
 };
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 
 #include "Build/Namespace.hpp"
 #include "Types/FundamentalTypes.hpp"
@@ -45,25 +46,28 @@ class LinkedChunkListNode
 
         #pragma region Members
 
-        std::array<TType, element_count>        data      {};
-        LinkedChunkListNode<TType, TChunkSize>* next_node {nullptr};
-        LinkedChunkListNode<TType, TChunkSize>* prev_node {nullptr};
+        std::array<TType, element_count>                     data      {};
+        std::atomic<LinkedChunkListNode<TType, TChunkSize>*> next_node {nullptr};
+        LinkedChunkListNode<TType, TChunkSize>*              prev_node {nullptr};
+
+        // Position of the node in its list, this allows to walk back from the tail without reading the size of the list
+        RkSize index {0ULL};
 
         #pragma endregion
 
         #pragma region Constructors
 
         LinkedChunkListNode()                                   = default;
-        LinkedChunkListNode(LinkedChunkListNode const& in_copy) = default;
-        LinkedChunkListNode(LinkedChunkListNode&&      in_move) = default;
+        LinkedChunkListNode(LinkedChunkListNode const& in_copy) = delete;
+        LinkedChunkListNode(LinkedChunkListNode&&      in_move) = delete;
         ~LinkedChunkListNode()                                  = default;
 
         #pragma endregion
 
         #pragma region Operators
 
-        LinkedChunkListNode& operator=(LinkedChunkListNode const& in_copy) = default;
-        LinkedChunkListNode& operator=(LinkedChunkListNode&&      in_move) = default;
+        LinkedChunkListNode& operator=(LinkedChunkListNode const& in_copy) = delete;
+        LinkedChunkListNode& operator=(LinkedChunkListNode&&      in_move) = delete;
 
         #pragma endregion
 };
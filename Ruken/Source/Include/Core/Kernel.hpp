@@ -35,6 +35,8 @@
 #include "Core/Service.hpp"
 #include "Core/ServiceProvider.hpp"
 
+#include "Time/FixedTimestep.hpp"
+
 #include "Debug/Logging/Logger.hpp"
 #include "Debug/Logging/Handlers/ConsoleHandler.hpp"
 
@@ -58,6 +60,7 @@ class Kernel
         RkInt               m_exit_code          {0};
         ConsoleHandler      m_console_handler    {};
         std::atomic<RkBool> m_shutdown_requested {false};
+        FixedTimestep       m_simulation_step;
 
         #pragma endregion
 
@@ -95,6 +98,15 @@ class Kernel
          */
         RkVoid RequestShutdown(RkInt in_exit_code) noexcept;
 
+        /**
+         * \brief Returns the fixed timestep driving the simulation
+         * \note The interpolation alpha of the timestep can be used by the rendering to blend
+         *       between the 2 last simulated states, see FixedTimestep::GetInterpolationAlpha
+         * \return Simulation timestep
+         */
+        [[nodiscard]]
+        FixedTimestep const& GetSimulationTimestep() const noexcept;
+
         /**
          * \brief Attempts to setup a service to the service provider
          * \note If a required service fails, any consequent call to this method will be ignored to allow
@@ -0,0 +1,133 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Debug/Tracing/TraceEvent.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Ring buffer of trace events, owned by a single thread
+ *
+ * Only the owning thread pushes events, without any synchronization.
+ * Once full, the oldest events are overwritten, this way tracing never allocates nor blocks.
+ *
+ * Any other thread can read or clear the buffer while the owner is pushing, in a seqlock fashion:
+ * the head of the buffer acts as the sequence, and the events overwritten while being read are dropped by the reader.
+ * Clearing the buffer only moves the first readable event, the owner is thus the only one writing the head.
+ */
+class TraceBuffer
+{
+    private:
+
+        #pragma region Members
+
+        // Events are stored field by field in atomics, readers might read a slot being overwritten
+        struct Slot
+        {
+            std::atomic<RkChar const*> name      {nullptr};
+            std::atomic<RkChar const*> category  {nullptr};
+            std::atomic<RkUint64>      timestamp {0ULL};
+            std::atomic<RkChar>        phase     {'i'};
+        };
+
+        std::unique_ptr<Slot[]> m_slots       {};
+        RkSize                  m_mask        {0ULL};
+        std::atomic<RkSize>     m_head        {0ULL};
+        std::atomic<RkSize>     m_first       {0ULL};
+        RkSize                  m_thread_id   {0ULL};
+        std::string             m_thread_name {};
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \brief Default constructor
+         * \param in_capacity Number of events kept by the buffer, rounded up to the next power of 2
+         * \param in_thread_id Identifier of the owning thread in the trace
+         */
+        TraceBuffer(RkSize in_capacity, RkSize in_thread_id) noexcept;
+
+        TraceBuffer(TraceBuffer const& in_copy) = delete;
+        TraceBuffer(TraceBuffer&&      in_move) = delete;
+        ~TraceBuffer()                          = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Pushes an event, overwriting the oldest one if the buffer is full
+         * \param in_event Event to push
+         * \note This must only be called by the owning thread
+         */
+        RkVoid Push(TraceEvent const& in_event) noexcept;
+
+        /**
+         * \brief Drops every event of the buffer
+         * \note This can be called from any thread, even while the owning thread is pushing
+         */
+        RkVoid Clear() noexcept;
+
+        /**
+         * \brief Copies the events of the buffer, from the oldest to the newest
+         * \return Events of the buffer
+         * \note This can be called from any thread, even while the owning thread is pushing.
+         *       Events overwritten during the copy are dropped, the returned events are never torn nor duplicated
+         */
+        [[nodiscard]]
+        std::vector<TraceEvent> GetEvents() const noexcept;
+
+        /**
+         * \brief Sets the name of the owning thread, displayed by the trace viewers
+         * \param in_name Name of the thread
+         */
+        RkVoid SetThreadName(std::string const& in_name) noexcept;
+
+        // Getters
+        [[nodiscard]] RkSize             GetThreadId  () const noexcept;
+        [[nodiscard]] std::string const& GetThreadName() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        TraceBuffer& operator=(TraceBuffer const& in_copy) = delete;
+        TraceBuffer& operator=(TraceBuffer&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,102 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include "Build/Config.hpp"
+#include "Build/Namespace.hpp"
+#include "Meta/Meta.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Debug/Tracing/Tracer.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Records a duration event, from the construction to the destruction of the scope
+ * \note Whether the tracer is recording is only checked once, at construction
+ * \see Tracer, RUKEN_TRACE_SCOPE
+ */
+class TraceScope
+{
+    private:
+
+        #pragma region Members
+
+        RkChar const* m_name;
+        RkChar const* m_category;
+        RkBool        m_recording;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \brief Begins the event if the tracer is recording
+         * \param in_name Name of the event, must outlive the tracer
+         * \param in_category Category of the event, must outlive the tracer
+         */
+        TraceScope(RkChar const* in_name, RkChar const* in_category) noexcept;
+
+        TraceScope(TraceScope const& in_copy) = delete;
+        TraceScope(TraceScope&&      in_move) = delete;
+        ~TraceScope() noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        TraceScope& operator=(TraceScope const& in_copy) = delete;
+        TraceScope& operator=(TraceScope&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+#include "Debug/Tracing/TraceScope.inl"
+
+#if defined(RUKEN_TRACING_ENABLED)
+
+    /**
+     * \brief Records a duration event until the end of the current scope
+     * \param in_name Name of the event, must outlive the tracer
+     * \param in_category Category of the event, must outlive the tracer
+     */
+    #define RUKEN_TRACE_SCOPE(in_name, in_category) TraceScope const RUKEN_GLUE(trace_scope_, __LINE__) {in_name, in_category};
+
+    /**
+     * \brief Records an instant event
+     * \param in_name Name of the event, must outlive the tracer
+     * \param in_category Category of the event, must outlive the tracer
+     */
+    #define RUKEN_TRACE_INSTANT(in_name, in_category) if (Tracer::IsEnabled()) { Tracer::Instant(in_name, in_category); }
+
+#else
+
+    #define RUKEN_TRACE_SCOPE(in_name, in_category)
+    #define RUKEN_TRACE_INSTANT(in_name, in_category)
+
+#endif
+
+END_RUKEN_NAMESPACE
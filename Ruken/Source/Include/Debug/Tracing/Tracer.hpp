@@ -0,0 +1,171 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Debug/Tracing/TraceBuffer.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Records a timeline of what every thread is doing, dumpable as a Chrome trace event file
+ *        (viewable in chrome://tracing or https://ui.perfetto.dev)
+ *
+ * Every thread records its events into its own ring buffer, created the first time the thread records an event.
+ * Recording never blocks nor allocates (besides this first event), and costs a single relaxed load when tracing is stopped.
+ * Instrumented code should use the RUKEN_TRACE_SCOPE and RUKEN_TRACE_INSTANT macros (see TraceScope.hpp)
+ * which also strip any tracing code from builds defining RUKEN_REQUEST_NO_TRACING_BUILD.
+ */
+class Tracer
+{
+    private:
+
+        #pragma region Members
+
+        inline static std::atomic<RkBool>   m_enabled    {false};
+        inline static std::atomic<RkUint64> m_start_time {0ULL};
+
+        // Buffers are never destroyed, this way a buffer outlives its thread and can still be dumped
+        inline static std::mutex                                m_buffers_mutex {};
+        inline static std::vector<std::unique_ptr<TraceBuffer>> m_buffers       {};
+
+        inline static thread_local TraceBuffer* m_thread_buffer {nullptr};
+        inline static thread_local std::string  m_thread_name   {};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the buffer of the calling thread, creating it if needed
+         * \return Buffer of the calling thread
+         */
+        static TraceBuffer& GetThreadBuffer() noexcept;
+
+        /**
+         * \brief Records an event in the buffer of the calling thread
+         * \param in_name Name of the event
+         * \param in_category Category of the event
+         * \param in_phase Chrome trace event phase
+         */
+        static RkVoid Record(RkChar const* in_name, RkChar const* in_category, RkChar in_phase) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        Tracer()                      = delete;
+        Tracer(Tracer const& in_copy) = delete;
+        Tracer(Tracer&&      in_move) = delete;
+        ~Tracer()                     = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Drops any previously recorded event and starts recording
+         * \note This can be called while other threads are recording, see TraceBuffer
+         */
+        static RkVoid Start() noexcept;
+
+        /**
+         * \brief Stops recording, the recorded events are kept until the next call to Start()
+         */
+        static RkVoid Stop() noexcept;
+
+        /**
+         * \brief Checks if the tracer is currently recording
+         * \return True if recording
+         */
+        [[nodiscard]]
+        static RkBool IsEnabled() noexcept;
+
+        /**
+         * \brief Returns the current time of the clock used by the tracer
+         * \return Timestamp in nanoseconds
+         */
+        [[nodiscard]]
+        static RkUint64 GetTimestamp() noexcept;
+
+        /**
+         * \brief Records the beginning of a duration event on the calling thread
+         * \param in_name Name of the event, must outlive the tracer
+         * \param in_category Category of the event, must outlive the tracer
+         * \note Begin and end events must be properly nested on a given thread, see TraceScope
+         */
+        static RkVoid Begin(RkChar const* in_name, RkChar const* in_category) noexcept;
+
+        /**
+         * \brief Records the end of the last duration event begun on the calling thread
+         * \param in_name Name of the event, must outlive the tracer
+         * \param in_category Category of the event, must outlive the tracer
+         */
+        static RkVoid End(RkChar const* in_name, RkChar const* in_category) noexcept;
+
+        /**
+         * \brief Records an instant event on the calling thread
+         * \param in_name Name of the event, must outlive the tracer
+         * \param in_category Category of the event, must outlive the tracer
+         */
+        static RkVoid Instant(RkChar const* in_name, RkChar const* in_category) noexcept;
+
+        /**
+         * \brief Names the calling thread in the trace
+         * \param in_name Name of the thread
+         */
+        static RkVoid SetCurrentThreadName(std::string const& in_name) noexcept;
+
+        /**
+         * \brief Writes every recorded event into a Chrome trace event (json) file
+         * \param in_path Path of the file to write
+         * \return True if the file has been written
+         * \note This can be called while other threads are recording, events overwritten during the dump are dropped.
+         *       Scopes opened before the tracer has been stopped still record their end event after it.
+         */
+        static RkBool Dump(std::string const& in_path) noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        Tracer& operator=(Tracer const& in_copy) = delete;
+        Tracer& operator=(Tracer&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+#include "Debug/Tracing/Tracer.inl"
+
+END_RUKEN_NAMESPACE
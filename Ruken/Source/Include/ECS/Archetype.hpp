@@ -25,6 +25,8 @@
 #pragma once
 
 #include <list>
+#include <mutex>
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 
@@ -36,6 +38,7 @@
 #include "ECS/Range.hpp"
 #include "ECS/Entity.hpp"
 #include "ECS/ComponentBase.hpp"
+#include "ECS/ArchetypeStatistics.hpp"
 #include "ECS/ArchetypeFingerprint.hpp"
 
 BEGIN_RUKEN_NAMESPACE
@@ -60,13 +63,43 @@ class Archetype
 {
     protected:
 
+        /**
+         * \brief Block of rows handed to a thread by the concurrent creation path
+         */
+        struct RowsReservation
+        {
+            Range  rows     {0ULL, 0ULL}; // Rows of the block
+            RkSize claimed  {0ULL};       // Number of rows of the block already used by entities
+            RkBool recycled {false};      // True if the rows have been taken from the free ranges
+        };
+
         #pragma region Members
 
+        inline static std::atomic<RkSize> m_instance_counter {0ULL};
+
         ArchetypeFingerprint m_fingerprint      {};
         std::list<Range>     m_free_entities    {};
-        RkSize               m_entities_count   {0ULL};
         RkSize               m_free_space_count {0ULL};
 
+        // Rows accounting, these can be modified concurrently by CreateEntityConcurrently()
+        // Rows in [0, m_rows_count) are either used by an entity, free (see m_free_entities) or reserved by a thread
+        // Rows in [0, m_committed_rows_count) are the only ones visited by the views
+        std::atomic<RkSize> m_entities_count       {0ULL};
+        std::atomic<RkSize> m_rows_count           {0ULL};
+        std::atomic<RkSize> m_committed_rows_count {0ULL};
+        std::atomic<RkSize> m_rows_capacity        {0ULL};
+        std::mutex          m_storage_mutex        {};
+
+        // Per thread row reservations, used by the concurrent creation path.
+        // Until the next call to CommitReservations(), recycled rows are still recorded in the free ranges
+        // and grown rows lie past the committed rows count, this way views skip every reserved row.
+        RkSize const                     m_instance_id        {m_instance_counter++};
+        std::list<RowsReservation>       m_reservations       {};
+        std::list<Range>                 m_recycled_rows      {}; // Recycled blocks entirely claimed since the last commit
+        std::list<Range>::const_iterator m_recycling_range    {m_free_entities.cbegin()};
+        RkSize                           m_recycling_offset   {0ULL};
+        std::mutex                       m_reservations_mutex {};
+
         std::unordered_map<RkSize, std::unique_ptr<ComponentBase>> m_components {};
 
         #pragma endregion 
@@ -74,11 +107,56 @@ class Archetype
         #pragma region Methods
 
         /**
-         * \brief Returns a free entity location by either looking up for a free spot, or allocating a new one 
+         * \brief Returns a free entity location by looking up for a free spot
+         * \warning This method assumes that there is at least one free location available
          * \return Free entity location
          */
         RkSize GetFreeEntityLocation() noexcept;
 
+        /**
+         * \brief Marks a location as free, merging it into the free entities ranges
+         * \param in_location Location to release
+         */
+        RkVoid ReleaseLocation(RkSize in_location) noexcept;
+
+        /**
+         * \brief Marks a range of locations as free, merging it with the contiguous free ranges
+         * \param in_range Range to release, must not overlap any free range
+         */
+        RkVoid ReleaseRange(Range const& in_range) noexcept;
+
+        /**
+         * \brief Removes a range of locations from the free ranges
+         * \param in_range Range to remove, must be contained in a single free range
+         */
+        RkVoid ClaimRange(Range const& in_range) noexcept;
+
+        /**
+         * \brief Restarts the recycling of the free ranges by the concurrent creation path from the first free range
+         *        This must be called every time the free ranges are modified
+         */
+        RkVoid ResetRecycling() noexcept;
+
+        /**
+         * \brief Ensures that every component of the archetype has the storage required for a given amount of rows
+         *        This is safe to call from multiple threads, the storage lock is only taken if the storage has to grow.
+         * \param in_rows_count Number of rows to ensure
+         */
+        RkVoid EnsureRowStorage(RkSize in_rows_count) noexcept;
+
+        /**
+         * \brief Returns the row reservation of the calling thread for this archetype, registering it if needed
+         * \return Reservation of the calling thread
+         */
+        RowsReservation& GetThreadReservation() noexcept;
+
+        /**
+         * \brief Claims a new block of rows for a consumed reservation
+         *        Free rows are recycled before growing the archetype, without removing them from the free ranges
+         * \param io_reservation Reservation to refill
+         */
+        RkVoid RefillReservation(RowsReservation& io_reservation) noexcept;
+
         #pragma endregion 
 
     public:
@@ -88,8 +166,8 @@ class Archetype
         template <ComponentType... TComponents>
         Archetype(Tag<TComponents...>) noexcept;
 
-        Archetype(Archetype const& in_copy) = default;
-        Archetype(Archetype&&      in_move) = default;
+        Archetype(Archetype const& in_copy) = delete;
+        Archetype(Archetype&&      in_move) = delete;
         ~Archetype()                        = default;
 
         #pragma endregion
@@ -101,6 +179,29 @@ class Archetype
         [[nodiscard]] ArchetypeFingerprint const& GetFingerprint       () const noexcept;
         [[nodiscard]] RkSize                      GetEntitiesCount     () const noexcept;
 
+        /**
+         * \brief Returns the number of rows of the archetype, rows are either used by an entity, free or reserved by a thread
+         * \return Rows count, this is the upper bound of the local entity identifiers
+         */
+        [[nodiscard]]
+        RkSize GetRowsCount() const noexcept;
+
+        /**
+         * \brief Returns the number of rows visited by the views
+         *        Rows grown by the concurrent creation path are only committed by CommitReservations()
+         * \return Committed rows count
+         */
+        [[nodiscard]]
+        RkSize GetCommittedRowsCount() const noexcept;
+
+        /**
+         * \brief Computes the occupancy and memory statistics of the archetype
+         * \return Archetype statistics
+         * \note This walks the free entities ranges and must be called from a synchronization point
+         */
+        [[nodiscard]]
+        ArchetypeStatistics GetStatistics() const noexcept;
+
         /**
          * \brief Returns a component of the passed type stored in this archetype
          * \tparam TComponent Component to look for
@@ -121,6 +222,31 @@ class Archetype
         [[nodiscard]]
         Entity CreateEntity() noexcept;
 
+        /**
+         * \brief Creates an entity in the archetype, this method is safe to call from any thread
+         *
+         * Every thread owns a block of pre-reserved rows in the archetype, claimed with a single atomic bump
+         * of the rows count. Entities are then created from this block without any synchronization.
+         * The storage lock of the archetype is only taken when the claimed block requires the storage to grow.
+         *
+         * \return Entity handle.
+         * \see Entity for lifetime info
+         * \note Reservations are carved out of the free ranges before the archetype grows.
+         *       Views can iterate the archetype meanwhile, they skip every reserved row and
+         *       only visit the entities created this way after the next call to CommitReservations().
+         * \warning This method can be called concurrently with itself, but not with CreateEntity() or DeleteEntity().
+         */
+        [[nodiscard]]
+        Entity CreateEntityConcurrently() noexcept;
+
+        /**
+         * \brief Commits the rows claimed by the concurrent creation path and releases the unclaimed ones
+         *        back into the free entities ranges
+         * \note This must be called from a synchronization point, when no thread is creating entities concurrently,
+         *       and before any call to CreateEntity() or DeleteEntity() following concurrent creations
+         */
+        RkVoid CommitReservations() noexcept;
+
         /**
          * \brief Deletes an entity from the archetype
          * \param in_local_identifier Local identifier of the entity, if invalid, this method does nothing
@@ -140,8 +266,8 @@ class Archetype
 
         #pragma region Operators
 
-        Archetype& operator=(Archetype const& in_copy) = default;
-        Archetype& operator=(Archetype&&      in_move) = default;
+        Archetype& operator=(Archetype const& in_copy) = delete;
+        Archetype& operator=(Archetype&&      in_move) = delete;
 
         #pragma endregion
 };
@@ -0,0 +1,72 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Memory statistics of a single field of a component.
+ *        Every field is stored in its own LinkedChunkList.
+ */
+struct FieldStatistics
+{
+    RkSize element_size        {0ULL}; // Size in bytes of one element of the field
+    RkSize chunk_element_count {0ULL}; // Number of elements stored by one chunk
+    RkSize chunks_count        {0ULL}; // Number of chunks currently allocated
+    RkSize allocated_bytes     {0ULL}; // Total memory allocated for the field, including chunk overhead
+};
+
+/**
+ * \brief Memory statistics of a component stored in an archetype
+ */
+struct ComponentStatistics
+{
+    RkSize                       component_id {0ULL};
+    std::vector<FieldStatistics> fields       {};
+};
+
+/**
+ * \brief Occupancy and memory statistics of an archetype
+ * \see Archetype::GetStatistics, EntityAdmin::GetArchetypesStatistics
+ */
+struct ArchetypeStatistics
+{
+    RkSize  entities_count      {0ULL}; // Number of live entities
+    RkSize  rows_count          {0ULL}; // Number of rows in use (live, free or reserved)
+    RkSize  capacity            {0ULL}; // Number of rows the storage can hold without allocating
+    RkSize  free_ranges_count   {0ULL}; // Number of free ranges, a high number indicates fragmentation
+    RkSize  free_entities_count {0ULL}; // Number of free rows in these ranges
+    RkSize  allocated_bytes     {0ULL}; // Total memory allocated by every component of the archetype
+    RkFloat chunk_utilization   {0.0F}; // Ratio of live entities over the allocated capacity, between 0 and 1
+
+    std::vector<ComponentStatistics> components {};
+};
+
+END_RUKEN_NAMESPACE
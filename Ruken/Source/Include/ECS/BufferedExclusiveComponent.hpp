@@ -0,0 +1,151 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <tuple>
+#include <atomic>
+
+#include "Meta/Assert.hpp"
+#include "Build/Namespace.hpp"
+
+#include "ECS/ComponentBase.hpp"
+#include "ECS/Meta/FieldHelper.hpp"
+#include "ECS/Safety/ComponentFieldType.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Buffered exclusive components are exclusive components allowing one writer system
+ *        to run concurrently with any number of reader systems.
+ *
+ * The component holds multiple copies of its fields. Readers (constant accesses) always see the last published copy,
+ * and never wait on the writer. The writer (non constant accesses) works on its own copy, which is published
+ * by the entity admin at the end of every frame. Readers thus observe the state of the previous frame.
+ *
+ * With 2 buffers, a reference obtained by a reader is valid until the end of the frame.
+ * With 3 buffers, that reference stays valid for one more frame, which allows consumers running
+ * one frame late (the rendering for instance) to keep reading a consistent state while the simulation moves on.
+ *
+ * \note Only one system should ever write into the component during a frame
+ * \tparam TBufferCount Number of buffers, 2 for double buffering, 3 for triple buffering
+ * \tparam TFields Fields of the component
+ */
+template <RkSize TBufferCount, ComponentFieldType... TFields>
+class BufferedExclusiveComponent final: public ComponentBase
+{
+    RUKEN_STATIC_ASSERT(TBufferCount >= 2ULL, "A buffered exclusive component requires at least 2 buffers, use an ExclusiveComponent instead.");
+
+    using Helper = FieldHelper<TFields...>;
+    using Buffer = std::tuple<typename TFields::Type...>;
+
+    private:
+
+        #pragma region Members
+
+        std::array<Buffer, TBufferCount> m_buffers     {};
+        std::atomic<RkSize>              m_front_index {0ULL}; // Last published buffer, read by the readers
+        RkSize                           m_back_index  {1ULL}; // Buffer currently written by the writer
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        BufferedExclusiveComponent() noexcept;
+        BufferedExclusiveComponent(BufferedExclusiveComponent const& in_copy) = delete;
+        BufferedExclusiveComponent(BufferedExclusiveComponent&&      in_move) = delete;
+        virtual ~BufferedExclusiveComponent() override                        = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        RUKEN_DEFINE_COMPONENT_ID_DECLARATION
+
+        /**
+         * \note This method is never called since exclusive components do not live in archetypes
+         *
+         * \brief Ensures that the component has enough storage space for a given amount of entities
+         * \param in_size Size to ensure
+         * \return Minimum number of elements allocated by one of the containers in the layout
+         */
+        [[nodiscard]] 
+        virtual RkSize EnsureStorageSpace(RkSize in_size) noexcept override;
+
+        /**
+         * \brief Publishes the buffer of the writer, making it visible to the readers.
+         *        The writer then continues working on a copy of the published buffer
+         * \note This is called by the entity admin at the end of every frame,
+         *       when no system is accessing the component
+         */
+        virtual RkVoid Publish() noexcept override;
+
+        /**
+         * \brief Fetches a field from the buffer of the writer
+         * \tparam TField Field to fetch
+         * \return Reference to the field
+         */
+        template <ComponentFieldType TField> requires Helper::template FieldExists<TField>::value
+        [[nodiscard]] typename TField::Type& Fetch() noexcept
+        { return std::get<Helper::template FieldIndex<TField>::value>(m_buffers[m_back_index]); }
+
+        /**
+         * \brief Fetches a field from the last published buffer, this never waits on the writer
+         * \tparam TField Field to fetch
+         * \return Constant reference to the field
+         */
+        template <ComponentFieldType TField> requires Helper::template FieldExists<TField>::value
+        [[nodiscard]] typename TField::Type const& Fetch() const noexcept
+        { return std::get<Helper::template FieldIndex<TField>::value>(m_buffers[m_front_index.load(std::memory_order_acquire)]); }
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        BufferedExclusiveComponent& operator=(BufferedExclusiveComponent const& in_copy) = delete;
+        BufferedExclusiveComponent& operator=(BufferedExclusiveComponent&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+#include "ECS/BufferedExclusiveComponent.inl"
+
+/**
+ * \brief Shorthand to declare a double buffered exclusive component named "in_component_name"
+ * \param in_component_name Name of the component
+ * \param ... Fields of the component. Theses must inherit from the ComponentField class
+ */
+#define RUKEN_DEFINE_DOUBLE_BUFFERED_EXCLUSIVE_COMPONENT(in_component_name, ...) using in_component_name = BufferedExclusiveComponent<2ULL, __VA_ARGS__>
+
+/**
+ * \brief Shorthand to declare a triple buffered exclusive component named "in_component_name"
+ * \param in_component_name Name of the component
+ * \param ... Fields of the component. Theses must inherit from the ComponentField class
+ */
+#define RUKEN_DEFINE_TRIPLE_BUFFERED_EXCLUSIVE_COMPONENT(in_component_name, ...) using in_component_name = BufferedExclusiveComponent<3ULL, __VA_ARGS__>
+
+END_RUKEN_NAMESPACE
@@ -27,6 +27,8 @@
 #include "Build/Namespace.hpp"
 #include "Types/FundamentalTypes.hpp"
 
+#include "ECS/ArchetypeStatistics.hpp"
+
 BEGIN_RUKEN_NAMESPACE
 
 class Archetype;
@@ -78,6 +80,20 @@ class ComponentBase
         [[nodiscard]]
         virtual RkSize EnsureStorageSpace(RkSize in_size) noexcept = 0;
 
+        /**
+         * \brief Fills the memory statistics of the component storage.
+         *        Components without any storage (such as tag components) leave the statistics untouched
+         * \param out_statistics Statistics to fill
+         */
+        virtual RkVoid CollectStatistics(ComponentStatistics& out_statistics) const noexcept;
+
+        /**
+         * \brief Publishes any pending write of the component.
+         *        This is called by the entity admin at the end of every frame and does nothing by default
+         * \see BufferedExclusiveComponent
+         */
+        virtual RkVoid Publish() noexcept;
+
         #pragma endregion
 
         #pragma region Operators
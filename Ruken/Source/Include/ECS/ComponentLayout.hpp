@@ -42,6 +42,8 @@
 #include "Types/FundamentalTypes.hpp"
 #include "Containers/LinkedChunkList.hpp"
 
+#include "ECS/ArchetypeStatistics.hpp"
+
 BEGIN_RUKEN_NAMESPACE
 
 class Archetype;
@@ -93,6 +95,12 @@ class ComponentLayout
         template <RkSize... TIds>
         static RkSize EnsureStorageSpaceHelper(ContainerType& in_container, RkSize in_size, std::index_sequence<TIds...>) noexcept;
 
+        /**
+         * \brief CollectStatistics helper
+         */
+        template <RkSize... TIds>
+        static RkVoid CollectStatisticsHelper(ContainerType const& in_container, ComponentStatistics& out_statistics, std::index_sequence<TIds...>) noexcept;
+
         #pragma endregion
 
     public:
@@ -131,6 +139,13 @@ class ComponentLayout
          */
         static RkSize EnsureStorageSpace(ContainerType& in_container, RkSize in_size) noexcept;
 
+        /**
+         * \brief Appends the memory statistics of every field of the passed container
+         * \param in_container Container to inspect
+         * \param out_statistics Statistics to fill
+         */
+        static RkVoid CollectStatistics(ContainerType const& in_container, ComponentStatistics& out_statistics) noexcept;
+
         #pragma endregion 
 
         #pragma region Operators
@@ -24,6 +24,8 @@
 
 #pragma once
 
+#include <list>
+#include <algorithm>
 #include <type_traits>
 
 #include "Build/Namespace.hpp"
@@ -92,6 +94,9 @@ class ComponentView<TPack<TIndices...>, TFields...>
         // Current entity index we are referencing (local entity identifier)
         RkSize m_index {0ULL};
 
+        // Next entity index to look at, rows before this index have already been visited
+        RkSize m_next_index {0ULL};
+
         #pragma endregion 
 
     public:
@@ -115,6 +120,8 @@ class ComponentView<TPack<TIndices...>, TFields...>
 
         /**
          * \brief Updates the view to reference the next entity found, if the view found nothing, false is returned
+         *        Rows contained in the free ranges of the archetype or past its committed rows are skipped,
+         *        the first call references the first entity
          * \return True if the next entity has been found, false otherwise
          */
         [[nodiscard]] RkBool FindNextEntity() noexcept;
@@ -26,15 +26,22 @@
 
 #include <vector>
 #include <memory>
+#include <typeinfo>
+#include <shared_mutex>
 #include <unordered_map>
 
 #include "Build/Namespace.hpp"
 
+#include "Meta/Meta.hpp"
+
 #include "Core/Service.hpp"
 
 #include "ECS/Entity.hpp"
 #include "ECS/Archetype.hpp"
 #include "ECS/SystemBase.hpp"
+#include "ECS/ArchetypeStatistics.hpp"
+
+#include "Debug/Logging/Logger.hpp"
 
 #include "Threading/Scheduler.hpp"
 #include "Threading/ExecutionPlan.hpp"
@@ -57,13 +64,28 @@ class EntityAdmin final: public Service<EntityAdmin>
         #pragma region Members
 
         std::vector       <std::unique_ptr<SystemBase>>                      m_systems              {};
+        std::vector       <RkChar const*>                                    m_systems_names        {};
         std::unordered_map<ArchetypeFingerprint, std::unique_ptr<Archetype>> m_archetypes           {};
         std::unordered_map<RkSize, std::unique_ptr<ComponentBase>>           m_exclusive_components {};
 
+        // Archetypes can be created concurrently (see GetArchetype), in which case
+        // their setup is deferred to the next synchronization point
+        std::shared_mutex       m_archetypes_mutex   {};
+        std::vector<Archetype*> m_pending_archetypes {};
+
         // Update related
         ExecutionPlan m_update_plan {};
         Scheduler*    m_scheduler   {nullptr};
 
+        // Disabled systems are not part of the update plan, systems without entities are skipped by the plan when ready.
+        // The plan is only rebuilt when this enabled mask changes or when the plan is marked as dirty
+        std::vector<RkBool> m_update_mask       {};
+        RkBool              m_update_plan_dirty {true};
+
+        // Introspection related
+        Logger* m_logger        {nullptr};
+        RkSize  m_updates_count {0ULL};
+
         #pragma endregion 
 
         #pragma region Methods
@@ -71,19 +93,50 @@ class EntityAdmin final: public Service<EntityAdmin>
         /**
          * \brief Creates a new archetype and handles any setup co-routine
          * \tparam TComponents Component types
+         * \note The archetypes mutex must be exclusively owned by the caller
          */
         template <ComponentType... TComponents>
         Archetype* CreateArchetype() noexcept;
 
+        /**
+         * \brief References a newly created archetype into every system matching it
+         * \param in_archetype Archetype to setup
+         */
+        RkVoid SetupArchetype(Archetype& in_archetype) noexcept;
+
+        /**
+         * \brief Synchronization point of the entity admin.
+         *        Setups any archetype created concurrently and commits the rows reserved by the concurrent creation path
+         */
+        RkVoid SynchronizeArchetypes() noexcept;
+
+        /**
+         * \brief Publishes the pending writes of every exclusive component, see BufferedExclusiveComponent
+         * \note This must be called when no system is running
+         */
+        RkVoid PublishExclusiveComponents() noexcept;
+
         /**
          * \brief Builds or rebuilds the update plan
          */
         RkVoid BuildUpdatePlan() noexcept;
 
+        /**
+         * \brief Refreshes the enabled mask of the systems and rebuilds the update plan if needed
+         */
+        RkVoid RefreshUpdatePlan() noexcept;
+
         #pragma endregion 
 
     public:
 
+        #pragma region Members
+
+        // Static name of the service, used by the kernel to report service errors
+        constexpr static const RkChar* service_name = RUKEN_STRING(EntityAdmin);
+
+        #pragma endregion
+
         #pragma region Constructors
 
         EntityAdmin(ServiceProvider& in_service_provider) noexcept;
@@ -98,6 +151,12 @@ class EntityAdmin final: public Service<EntityAdmin>
 
         // --- Simulation manipulation
 
+        /**
+         * \brief Forces the update plan to be rebuilt before the next update.
+         *        This is automatically done when an archetype or a system is created.
+         */
+        RkVoid InvalidateUpdatePlan() noexcept;
+
         RkVoid StartSimulation () noexcept;
         RkVoid UpdateSimulation() noexcept;
         RkVoid EndSimulation   () noexcept;
@@ -119,6 +178,27 @@ class EntityAdmin final: public Service<EntityAdmin>
         template <ComponentType... TComponents>
         Entity CreateEntity() noexcept;
 
+        /**
+         * \brief Returns the archetype containing exactly the passed components, creating it if needed.
+         *        This method is safe to call from any thread.
+         * \tparam TComponents Components of the archetype
+         * \return Archetype reference, valid as long as the entity admin lives
+         * \note Archetypes created by this method are only referenced by the systems at the next synchronization point.
+         *       Spawner systems should cache the returned archetype and call Archetype::CreateEntityConcurrently directly,
+         *       this way, no lock is ever taken on the hot path.
+         */
+        template <ComponentType... TComponents>
+        Archetype& GetArchetype() noexcept;
+
+        /**
+         * \brief Creates a new entity with given components, this method is safe to call from any thread (including system updates)
+         * \tparam TComponents Components to attach to the new entity
+         * \return Created entity id
+         * \see Archetype::CreateEntityConcurrently
+         */
+        template <ComponentType... TComponents>
+        Entity CreateEntityConcurrently() noexcept;
+
         /**
          * \brief Returns an exclusive component or instantiate it if needed
          * \tparam TComponent Component to access
@@ -127,6 +207,22 @@ class EntityAdmin final: public Service<EntityAdmin>
         template <ExclusiveComponentType TComponent>
         TComponent& GetExclusiveComponent() noexcept;
 
+        // --- Introspection
+
+        /**
+         * \brief Computes the occupancy and memory statistics of every archetype of the entity admin
+         * \return Statistics of every archetype
+         * \note This must be called from outside of a simulation update
+         */
+        [[nodiscard]]
+        std::vector<ArchetypeStatistics> GetArchetypesStatistics() noexcept;
+
+        /**
+         * \brief Logs a summary of the archetypes statistics.
+         *        This is called automatically every RUKEN_ECS_STATISTICS_LOG_PERIOD updates
+         */
+        RkVoid LogStatisticsSummary() noexcept;
+
         #pragma endregion
 
         #pragma region Operators
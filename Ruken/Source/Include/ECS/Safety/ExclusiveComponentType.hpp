@@ -34,6 +34,31 @@ BEGIN_RUKEN_NAMESPACE
 template <ComponentFieldType... TFields>
 class ExclusiveComponent;
 
+template <RkSize TBufferCount, ComponentFieldType... TFields>
+class BufferedExclusiveComponent;
+
+/**
+ * \brief Checks if the passed component is a buffered exclusive component
+ * \tparam TType Type to check
+ */
+template <typename TType>
+struct IsBufferedExclusiveComponent
+{
+    static constexpr RkBool value = false;
+};
+
+template <RkSize TBufferCount, ComponentFieldType... TFields>
+struct IsBufferedExclusiveComponent<BufferedExclusiveComponent<TBufferCount, TFields...>>
+{
+    static constexpr RkBool value = true;
+};
+
+template <RkSize TBufferCount, ComponentFieldType... TFields>
+struct IsBufferedExclusiveComponent<BufferedExclusiveComponent<TBufferCount, TFields...> const>
+{
+    static constexpr RkBool value = true;
+};
+
 /**
  * \brief Checks if the passed component is an exclusive component
  * \tparam TType Type to check
@@ -41,7 +66,8 @@ class ExclusiveComponent;
 template <typename TType>
 struct IsExclusiveComponent
 {
-    static constexpr RkBool value = IsInstance<std::remove_const_t<TType>, ExclusiveComponent>::value;
+    static constexpr RkBool value = IsInstance<std::remove_const_t<TType>, ExclusiveComponent>::value
+                                 || IsBufferedExclusiveComponent<TType>::value;
 };
 
 template <typename TType>
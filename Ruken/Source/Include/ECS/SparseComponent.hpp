@@ -98,6 +98,12 @@ class SparseComponent final : public ComponentBase
         [[nodiscard]]
         virtual RkSize EnsureStorageSpace(RkSize in_size) noexcept override;
 
+        /**
+         * \brief Fills the memory statistics of every field of the component
+         * \param out_statistics Statistics to fill
+         */
+        virtual RkVoid CollectStatistics(ComponentStatistics& out_statistics) const noexcept override;
+
         /**
          * \brief Returns a view containing all the requested fields
          * \tparam TView View type
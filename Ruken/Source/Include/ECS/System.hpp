@@ -121,6 +121,22 @@ class System : public SystemBase
          */
         virtual RkVoid AddReferenceGroup(Archetype& in_archetype) noexcept override final;
 
+        /**
+         * \brief Checks if the system has anything to update this frame.
+         *        A system iterating over entities only requires an update if it is enabled
+         *        and at least one of its groups contains a live entity.
+         * \return True if the system requires an update, false otherwise
+         */
+        [[nodiscard]]
+        virtual RkBool RequiresUpdate() const noexcept override;
+
+        /**
+         * \brief Returns the number of live entities referenced by the groups of the system
+         * \return Entities count
+         */
+        [[nodiscard]]
+        virtual RkSize GetEntitiesCount() const noexcept override final;
+
         /**
          * \brief Returns a reference onto the requested exclusive component
          * \note If this is the first access to the designated exclusive component, this method will allocate the component
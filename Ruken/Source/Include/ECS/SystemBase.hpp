@@ -45,6 +45,7 @@ class SystemBase
 
         #pragma region Members
 
+        // Disabled systems are left out of the update plan, which is rebuilt at the next update when this changes
         RkBool enabled {true};
 
         #pragma endregion
@@ -68,6 +69,21 @@ class SystemBase
 
         // --- Virtual
 
+        /**
+         * \brief Checks if the system has anything to update this frame.
+         *        Systems that don't require any update are skipped when the entity admin dispatches them.
+         * \return True if the system is enabled, false otherwise
+         */
+        [[nodiscard]]
+        virtual RkBool RequiresUpdate() const noexcept;
+
+        /**
+         * \brief Returns the number of live entities referenced by the system
+         * \return Entities count
+         */
+        [[nodiscard]]
+        virtual RkSize GetEntitiesCount() const noexcept = 0;
+
         /**
          * \brief Adds a component reference group to the system.
          *        This is called by the entity admin at the creation of a new archetype
@@ -0,0 +1,126 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <string_view>
+
+#include "Build/Namespace.hpp"
+#include "Build/OperatingSystem.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Read only file, opened for positional reads through the IOService
+ *
+ * Files can be opened for direct I/O, bypassing the page cache of the operating system.
+ * Direct reads are much cheaper for large assets that are only read once, but the offset, the size
+ * and the address of the buffer of every read must then be aligned on RUKEN_IO_DIRECT_ALIGNMENT.
+ */
+class File
+{
+    public:
+
+        #if defined(RUKEN_OS_WINDOWS)
+            using NativeHandle = RkVoid*;
+        #else
+            using NativeHandle = RkInt;
+        #endif
+
+    private:
+
+        #pragma region Members
+
+        NativeHandle m_handle;
+        RkUint64     m_size   {0ULL};
+        RkBool       m_direct {false};
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \brief Opens a file for reading
+         * \param in_path Path of the file
+         * \param in_direct Opens the file for direct I/O. If the file system does not support it, the file is opened normally
+         */
+        explicit File(std::string_view in_path, RkBool in_direct = false) noexcept;
+
+        File(File const& in_copy) = delete;
+        File(File&&      in_move) noexcept;
+        ~File() noexcept;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \return True if the file has been successfully opened
+         */
+        [[nodiscard]]
+        RkBool IsValid() const noexcept;
+
+        /**
+         * \return True if the file has been opened for direct I/O
+         */
+        [[nodiscard]]
+        RkBool IsDirect() const noexcept;
+
+        /**
+         * \return Size of the file in bytes, as of its opening
+         */
+        [[nodiscard]]
+        RkUint64 GetSize() const noexcept;
+
+        /**
+         * \return Native handle of the file (file descriptor on posix systems)
+         */
+        [[nodiscard]]
+        NativeHandle GetNativeHandle() const noexcept;
+
+        /**
+         * \brief Reads from the file, blocking the calling thread
+         * \param in_offset Offset of the read in the file
+         * \param out_buffer Destination buffer
+         * \param in_size Number of bytes to read
+         * \return Number of bytes read (lower than in_size at the end of the file), or a negative error code
+         * \note This is used by the thread pool backend of the IOService, prefer IOService::Read()
+         */
+        [[nodiscard]]
+        RkInt64 ReadAt(RkUint64 in_offset, RkVoid* out_buffer, RkSize in_size) const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        File& operator=(File const& in_copy) = delete;
+        File& operator=(File&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,79 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+struct IOChunk;
+
+/**
+ * \brief Interface of the backends executing the reads of the IOService.
+ *
+ * Backends own the threads waiting on the disk, reads are submitted from any thread and every chunk
+ * must be completed exactly once through IOService::CompleteChunk(), from any thread.
+ * Destroying a backend waits for every submitted chunk to be completed.
+ */
+class IOBackend
+{
+    public:
+
+        #pragma region Constructors
+
+        IOBackend()                         = default;
+        IOBackend(IOBackend const& in_copy) = delete;
+        IOBackend(IOBackend&&      in_move) = delete;
+        virtual ~IOBackend()                = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Submits a batch of chunks to read, this is safe to call from any thread
+         * \param in_chunks Chunks to read, must stay alive until completed
+         * \param in_count Number of chunks
+         */
+        virtual RkVoid Submit(IOChunk* in_chunks, RkSize in_count) noexcept = 0;
+
+        /**
+         * \return Name of the backend, used for logging purposes
+         */
+        [[nodiscard]]
+        virtual RkChar const* GetName() const noexcept = 0;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        IOBackend& operator=(IOBackend const& in_copy) = delete;
+        IOBackend& operator=(IOBackend&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,77 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <functional>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Threading/EJobPriority.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+class File;
+struct IORequest;
+
+/**
+ * \brief Callback invoked on a worker of the scheduler once a read is complete
+ * \param in_result Number of bytes read (lower than requested at the end of the file), or a negative error code
+ */
+using IOCallback = std::function<RkVoid(RkInt64 in_result)>;
+
+/**
+ * \brief Part of a read request, large reads are split in chunks of at most RUKEN_IO_MAX_CHUNK_SIZE bytes
+ *        so that they can be processed in parallel by the backend
+ */
+struct IOChunk
+{
+    IORequest* request    {nullptr};
+    RkUint64   offset     {0ULL};
+    RkByte*    buffer     {nullptr};
+    RkSize     size       {0ULL};
+    RkSize     read_bytes {0ULL};
+};
+
+/**
+ * \brief Read request in flight, owned by the IOService until its callback has been scheduled
+ */
+struct IORequest
+{
+    File const*  file     {nullptr};
+    IOCallback   callback {};
+    EJobPriority priority {EJobPriority::Normal};
+
+    std::unique_ptr<IOChunk[]> chunks           {};
+    RkSize                     chunks_count     {0ULL};
+    std::atomic<RkSize>        remaining_chunks {0ULL};
+
+    // Total of the bytes read by every chunk, and first error reported by any chunk (0 if none)
+    std::atomic<RkInt64> read_bytes {0LL};
+    std::atomic<RkInt64> error      {0LL};
+};
+
+END_RUKEN_NAMESPACE
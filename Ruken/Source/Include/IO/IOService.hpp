@@ -0,0 +1,169 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <functional>
+#include <string_view>
+
+#include "Meta/Meta.hpp"
+#include "Core/Service.hpp"
+
+#include "IO/File.hpp"
+#include "IO/IOBackend.hpp"
+#include "IO/IORequest.hpp"
+#include "IO/ReadAwaiter.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+class Logger;
+class Scheduler;
+
+/**
+ * \brief Asynchronous file reads, completing into the job system.
+ *
+ * Reads are executed by a dedicated backend, so that no worker of the scheduler ever blocks on the disk:
+ * - On Linux, reads are batched through io_uring (see IOUringBackend)
+ * - Otherwise, or if io_uring is unavailable, reads are executed by a small pool of I/O threads (see IOThreadPoolBackend)
+ * Large reads are split in chunks of at most RUKEN_IO_MAX_CHUNK_SIZE bytes, read in parallel straight into the buffer of the caller.
+ * Once every chunk of a read is done, its callback is scheduled on the scheduler, or the awaiting coroutine is resumed there.
+ *
+ * \note For files opened for direct I/O (see File), the offset, the size and the buffer of every read
+ *       must be aligned on RUKEN_IO_DIRECT_ALIGNMENT
+ */
+class IOService final : public Service<IOService>
+{
+    friend class IOUringBackend;
+    friend class IOThreadPoolBackend;
+
+    private:
+
+        #pragma region Members
+
+        Logger*    m_logger    {nullptr};
+        Scheduler* m_scheduler {nullptr};
+
+        std::unique_ptr<IOBackend> m_backend          {};
+        std::atomic<RkSize>        m_pending_requests {0ULL};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Completes a chunk of a read, and the read itself if this was its last chunk
+         * \param in_chunk Completed chunk
+         * \param in_result Number of bytes read by the chunk, or a negative error code
+         * \note This is called by the backends, from any thread
+         */
+        RkVoid CompleteChunk(IOChunk& in_chunk, RkInt64 in_result) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Members
+
+        // Static name of the service, used by the kernel to report service errors
+        constexpr static const RkChar* service_name = RUKEN_STRING(IOService);
+
+        #pragma endregion
+
+        #pragma region Constructors
+
+        IOService(ServiceProvider& in_service_provider) noexcept;
+
+        IOService(IOService const& in_copy) = delete;
+        IOService(IOService&&      in_move) = delete;
+        ~IOService() noexcept override;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Reads a part of a file asynchronously
+         * \param in_file File to read from, must stay opened until the read is complete
+         * \param in_offset Offset of the read in the file
+         * \param out_buffer Destination buffer, must stay alive until the read is complete
+         * \param in_size Number of bytes to read
+         * \param in_callback Invoked from a job of the given priority once the read is complete
+         * \param in_priority Priority of the completion job
+         */
+        RkVoid Read(File const&  in_file,
+                    RkUint64     in_offset,
+                    RkVoid*      out_buffer,
+                    RkSize       in_size,
+                    IOCallback&& in_callback,
+                    EJobPriority in_priority = EJobPriority::Normal) noexcept;
+
+        /**
+         * \brief Reads a part of a file asynchronously, from a coroutine
+         * \param in_file File to read from, must stay opened until the read is complete
+         * \param in_offset Offset of the read in the file
+         * \param out_buffer Destination buffer, must stay alive until the read is complete
+         * \param in_size Number of bytes to read
+         * \param in_priority Priority of the job resuming the coroutine
+         * \return Awaitable, returning the number of bytes read or a negative error code
+         */
+        [[nodiscard]]
+        ReadAwaiter ReadAsync(File const& in_file, RkUint64 in_offset, RkVoid* out_buffer, RkSize in_size, EJobPriority in_priority = EJobPriority::Normal) noexcept;
+
+        /**
+         * \brief Reads a whole file asynchronously
+         * \param in_path Path of the file
+         * \param in_callback Invoked from a job of the given priority with the content of the file, and the result of the read
+         *                    (size of the file, or a negative error code in which case the content is empty)
+         * \param in_priority Priority of the completion job
+         */
+        RkVoid ReadFile(std::string_view in_path,
+                        std::function<RkVoid(std::vector<RkByte>&& in_content, RkInt64 in_result)>&& in_callback,
+                        EJobPriority in_priority = EJobPriority::Normal) noexcept;
+
+        /**
+         * \return Name of the backend in use
+         */
+        [[nodiscard]]
+        RkChar const* GetBackendName() const noexcept;
+
+        /**
+         * \return Number of reads in flight
+         */
+        [[nodiscard]]
+        RkSize GetPendingRequestsCount() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        IOService& operator=(IOService const& in_copy) = delete;
+        IOService& operator=(IOService&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
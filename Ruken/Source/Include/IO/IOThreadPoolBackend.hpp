@@ -0,0 +1,100 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+#include "IO/IOBackend.hpp"
+#include "Threading/Worker.hpp"
+#include "Threading/ThreadSafeLockQueue.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+class IOService;
+
+/**
+ * \brief Portable IOService backend, blocking positional reads executed by a small pool of dedicated threads.
+ *
+ * The I/O threads spend most of their time waiting on the disk, they are never workers of the scheduler.
+ */
+class IOThreadPoolBackend final : public IOBackend
+{
+    private:
+
+        #pragma region Members
+
+        IOService&                    m_service;
+        ThreadSafeLockQueue<IOChunk*> m_chunks;
+        std::vector<Worker>           m_threads;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Job of every I/O thread, reads chunks until a null chunk is dequeued
+         */
+        RkVoid ThreadJob() noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \brief Thread pool backend constructor
+         * \param in_service Service completing the chunks
+         * \param in_threads_count Number of I/O threads, at least 1
+         */
+        IOThreadPoolBackend(IOService& in_service, RkSize in_threads_count) noexcept;
+
+        IOThreadPoolBackend(IOThreadPoolBackend const& in_copy) = delete;
+        IOThreadPoolBackend(IOThreadPoolBackend&&      in_move) = delete;
+        ~IOThreadPoolBackend() noexcept override;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        RkVoid Submit(IOChunk* in_chunks, RkSize in_count) noexcept override;
+
+        [[nodiscard]]
+        RkChar const* GetName() const noexcept override;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        IOThreadPoolBackend& operator=(IOThreadPoolBackend const& in_copy) = delete;
+        IOThreadPoolBackend& operator=(IOThreadPoolBackend&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
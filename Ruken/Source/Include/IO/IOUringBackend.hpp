@@ -0,0 +1,155 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <vector>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+#include "IO/IOBackend.hpp"
+#include "Threading/Worker.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+class IOService;
+
+/**
+ * \brief Linux IOService backend, batching reads through an io_uring instance.
+ *
+ * A single I/O thread owns the ring: it moves the submitted chunks into the submission queue,
+ * submits the whole batch and waits for completions with a single system call per batch.
+ * Chunks submitted while the thread is waiting wake it up through an eventfd read kept in flight in the ring.
+ *
+ * \note io_uring might be unavailable (old kernels, restricted containers), in which case IsValid() returns false
+ *       and the IOService falls back on the IOThreadPoolBackend. On other platforms, this backend is never valid.
+ */
+class IOUringBackend final : public IOBackend
+{
+    private:
+
+        #pragma region Members
+
+        IOService& m_service;
+
+        RkInt    m_ring_fd      {-1};
+        RkInt    m_wake_fd      {-1};
+        RkUint64 m_wake_counter {0ULL};
+
+        // Shared rings, mapped from the kernel
+        RkVoid*   m_sq_ring      {nullptr};
+        RkSize    m_sq_ring_size {0ULL};
+        RkVoid*   m_cq_ring      {nullptr};
+        RkSize    m_cq_ring_size {0ULL};
+        RkVoid*   m_sqes         {nullptr};
+        RkSize    m_sqes_size    {0ULL};
+        RkUint32* m_sq_head      {nullptr};
+        RkUint32* m_sq_tail      {nullptr};
+        RkUint32* m_sq_array     {nullptr};
+        RkUint32  m_sq_mask      {0U};
+        RkUint32  m_sq_entries   {0U};
+        RkUint32* m_cq_head      {nullptr};
+        RkUint32* m_cq_tail      {nullptr};
+        RkUint32  m_cq_mask      {0U};
+        RkVoid*   m_cqes         {nullptr};
+
+        // Chunks submitted by other threads, picked up by the I/O thread
+        std::mutex            m_pending_mutex {};
+        std::vector<IOChunk*> m_pending       {};
+        std::atomic<RkBool>   m_running       {false};
+        Worker                m_thread        {};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Creates and maps the ring
+         * \param in_entries Number of entries of the submission queue
+         * \return True on success
+         */
+        RkBool SetupRing(RkUint32 in_entries) noexcept;
+
+        /**
+         * \brief Queues a read into the submission queue, the queue must have a free entry
+         * \param in_chunk Chunk to read, nullptr to read the wake up eventfd
+         */
+        RkVoid PrepareRead(IOChunk* in_chunk) noexcept;
+
+        /**
+         * \brief Job of the I/O thread, submits and completes chunks until the backend is destroyed
+         */
+        RkVoid ThreadJob() noexcept;
+
+        /**
+         * \brief Wakes up the I/O thread
+         */
+        RkVoid WakeUp() const noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \brief io_uring backend constructor
+         * \param in_service Service completing the chunks
+         * \param in_queue_depth Maximum number of chunks in flight in the ring
+         */
+        IOUringBackend(IOService& in_service, RkUint32 in_queue_depth) noexcept;
+
+        IOUringBackend(IOUringBackend const& in_copy) = delete;
+        IOUringBackend(IOUringBackend&&      in_move) = delete;
+        ~IOUringBackend() noexcept override;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \return True if the ring has been successfully created
+         */
+        [[nodiscard]]
+        RkBool IsValid() const noexcept;
+
+        RkVoid Submit(IOChunk* in_chunks, RkSize in_count) noexcept override;
+
+        [[nodiscard]]
+        RkChar const* GetName() const noexcept override;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        IOUringBackend& operator=(IOUringBackend const& in_copy) = delete;
+        IOUringBackend& operator=(IOUringBackend&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,93 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <coroutine>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Threading/EJobPriority.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+class File;
+class IOService;
+
+/**
+ * \brief Awaitable returned by IOService::ReadAsync()
+ *
+ * Suspends the awaiting coroutine until the read is complete, the coroutine is then resumed on a worker of the scheduler.
+ * No thread is blocked on the disk in the meantime.
+ */
+class ReadAwaiter
+{
+    private:
+
+        #pragma region Members
+
+        IOService&   m_service;
+        File const&  m_file;
+        RkUint64     m_offset;
+        RkVoid*      m_buffer;
+        RkSize       m_size;
+        EJobPriority m_priority;
+        RkInt64      m_result {0LL};
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        ReadAwaiter(IOService& in_service, File const& in_file, RkUint64 in_offset, RkVoid* in_buffer, RkSize in_size, EJobPriority in_priority) noexcept;
+
+        ReadAwaiter(ReadAwaiter const& in_copy) = delete;
+        ReadAwaiter(ReadAwaiter&&      in_move) = delete;
+        ~ReadAwaiter()                          = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        [[nodiscard]]
+        RkBool await_ready  () const noexcept;
+        RkVoid await_suspend(std::coroutine_handle<> in_handle) noexcept;
+
+        /**
+         * \return Number of bytes read, or a negative error code
+         */
+        RkInt64 await_resume() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        ReadAwaiter& operator=(ReadAwaiter const& in_copy) = delete;
+        ReadAwaiter& operator=(ReadAwaiter&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,122 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory_resource>
+
+#include "Build/Config.hpp"
+
+#include "Memory/LinearAllocator.hpp"
+#include "Memory/LinearMemoryResource.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Per thread scratch memory, released at every frame boundary.
+ *
+ * Every thread (scheduler workers, main thread or any other thread) owns its own linear allocator,
+ * created the first time the thread requests frame memory. Allocating is thus a simple bump of an offset without any synchronization.
+ * The kernel starts a new frame by calling NextFrame(), each allocator is then reset by its owning thread
+ * the next time this thread calls SynchronizeThread(). Scheduler workers do so between 2 jobs,
+ * any other thread using frame memory must call it itself from a point where none of its frame memory is in use.
+ *
+ * This is meant for short lived temporaries in hot code (handle arrays, intermediate buffers, formatted strings...).
+ * Once every allocator has grown to its peak usage, frame allocations never hit the heap anymore.
+ *
+ * \warning Frame memory must never outlive the frame it has been allocated in,
+ *          jobs running across several frames (background jobs for instance) should not use it.
+ */
+class FrameAllocator
+{
+    private:
+
+        #pragma region Members
+
+        inline static std::atomic<RkUint64> m_frame_index {0ULL};
+
+        inline static thread_local LinearAllocator      m_thread_allocator   {RUKEN_FRAME_ALLOCATOR_CAPACITY};
+        inline static thread_local LinearMemoryResource m_thread_resource    {m_thread_allocator};
+        inline static thread_local RkUint64             m_thread_frame_index {0ULL};
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        FrameAllocator() = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Starts a new frame, releasing every frame allocation made so far
+         * \note This must be called once per frame by the kernel, from a point where no frame allocation is in use.
+         *       The allocator of the calling thread is synchronized right away.
+         */
+        static RkVoid NextFrame() noexcept;
+
+        /**
+         * \brief Resets the allocator of the calling thread if a new frame started since the last synchronization of the thread
+         * \warning Any frame memory previously allocated by the calling thread must not be in use anymore
+         */
+        static RkVoid SynchronizeThread() noexcept;
+
+        /**
+         * \return Index of the current frame
+         */
+        [[nodiscard]]
+        static RkUint64 GetFrameIndex() noexcept;
+
+        /**
+         * \return Frame allocator of the calling thread
+         */
+        [[nodiscard]]
+        static LinearAllocator& GetAllocator() noexcept;
+
+        /**
+         * \return Frame memory resource of the calling thread, to use with pmr containers
+         */
+        [[nodiscard]]
+        static std::pmr::memory_resource* GetResource() noexcept;
+
+        /**
+         * \brief Allocates an uninitialized array from the frame allocator of the calling thread
+         * \tparam TType Type of the elements
+         * \param in_count Number of elements
+         * \return Allocated array, valid until the end of the frame
+         */
+        template <typename TType>
+        [[nodiscard]]
+        static TType* Allocate(RkSize in_count) noexcept;
+
+        #pragma endregion
+};
+
+#include "Memory/FrameAllocator.inl"
+
+END_RUKEN_NAMESPACE
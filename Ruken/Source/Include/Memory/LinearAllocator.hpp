@@ -0,0 +1,135 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Linear (bump) allocator, handing out memory by simply moving an offset forward.
+ *
+ * Individual allocations are never freed, the whole allocator is released at once by calling Reset().
+ * When the current chunk is exhausted, a new bigger chunk is allocated from the heap.
+ * On reset, the chunks are coalesced into a single one large enough to fit everything that has been allocated,
+ * this way the allocator stops touching the heap once it has seen its peak usage.
+ *
+ * \note This class is not thread safe, see FrameAllocator for per thread instances
+ */
+class LinearAllocator
+{
+    private:
+
+        struct Chunk
+        {
+            std::unique_ptr<RkByte[]> data {nullptr};
+            RkSize                    size {0ULL};
+        };
+
+        #pragma region Members
+
+        std::vector<Chunk> m_chunks    {};
+        RkSize             m_offset    {0ULL};
+        RkSize             m_allocated {0ULL};
+        RkSize             m_peak      {0ULL};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Allocates a new chunk from the heap and makes it the current one
+         * \param in_size Size of the chunk in bytes
+         */
+        RkVoid AddChunk(RkSize in_size) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \param in_capacity Initial capacity of the allocator in bytes
+         */
+        explicit LinearAllocator(RkSize in_capacity) noexcept;
+
+        LinearAllocator(LinearAllocator const& in_copy) = delete;
+        LinearAllocator(LinearAllocator&&      in_move) = default;
+        ~LinearAllocator()                              = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Allocates a block of memory
+         * \param in_size Size of the block in bytes
+         * \param in_alignment Alignment of the block, must be a power of 2
+         * \return Allocated block, valid until the next call to Reset()
+         */
+        [[nodiscard]]
+        RkVoid* Allocate(RkSize in_size, RkSize in_alignment = alignof(std::max_align_t)) noexcept;
+
+        /**
+         * \brief Releases every allocation at once
+         * \warning Any memory previously returned by Allocate() must not be used anymore after this call
+         */
+        RkVoid Reset() noexcept;
+
+        /**
+         * \return Total size in bytes of the chunks owned by the allocator
+         */
+        [[nodiscard]]
+        RkSize GetCapacity() const noexcept;
+
+        /**
+         * \return Size in bytes requested since the last reset
+         */
+        [[nodiscard]]
+        RkSize GetAllocatedSize() const noexcept;
+
+        /**
+         * \return Highest size in bytes ever requested between 2 resets
+         */
+        [[nodiscard]]
+        RkSize GetPeakSize() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        LinearAllocator& operator=(LinearAllocator const& in_copy) = delete;
+        LinearAllocator& operator=(LinearAllocator&&      in_move) = default;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
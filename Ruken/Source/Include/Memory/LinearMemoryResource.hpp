@@ -0,0 +1,88 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <memory_resource>
+
+#include "Memory/LinearAllocator.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief std::pmr memory resource adapter over a linear allocator,
+ *        allowing any pmr container (std::pmr::vector, std::pmr::string...) to allocate from it.
+ *
+ * Deallocations are no-ops, the memory is only given back when the underlying allocator is reset.
+ * Since memory is never reused before a reset, containers growing many times should reserve their size up front.
+ */
+class LinearMemoryResource final : public std::pmr::memory_resource
+{
+    private:
+
+        #pragma region Members
+
+        LinearAllocator& m_allocator;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        RkVoid* do_allocate  (RkSize in_bytes, RkSize in_alignment) override;
+        RkVoid  do_deallocate(RkVoid* in_pointer, RkSize in_bytes, RkSize in_alignment) override;
+        RkBool  do_is_equal  (std::pmr::memory_resource const& in_other) const noexcept override;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        explicit LinearMemoryResource(LinearAllocator& in_allocator) noexcept;
+
+        LinearMemoryResource(LinearMemoryResource const& in_copy) = delete;
+        LinearMemoryResource(LinearMemoryResource&&      in_move) = delete;
+        ~LinearMemoryResource() override                          = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \return The allocator this resource allocates from
+         */
+        [[nodiscard]]
+        LinearAllocator& GetAllocator() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        LinearMemoryResource& operator=(LinearMemoryResource const& in_copy) = delete;
+        LinearMemoryResource& operator=(LinearMemoryResource&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,171 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <functional>
+
+#include "Build/Config.hpp"
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+#include "Functional/Event.hpp"
+#include "Rendering/RenderSnapshot.hpp"
+#include "Threading/CompletionToken.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+class Scheduler;
+
+/**
+ * \brief Overlaps the simulation of a frame with the rendering of the previous ones.
+ *
+ * Once the simulation of a frame is done, the kernel submits it to the pipeline which extracts
+ * a RenderSnapshot of the frame on the calling thread (see on_extract). The rendering of this snapshot
+ * is then done by a single driver job running on the scheduler, while the kernel moves on to the simulation of the next frame.
+ * Snapshots are rendered in submission order and the simulation can only run a bounded number of frames ahead of the rendering,
+ * this number of frames is the depth of the pipeline (RUKEN_FRAME_PIPELINE_DEPTH by default).
+ *
+ * \note A depth of 1 renders every frame before the simulation of the next one can start, just like a serial loop.
+ *       Every additional frame of depth adds one frame of input latency but hides up to one frame of rendering time.
+ * \warning The render callback only has access to the snapshot of the frame. Reading the simulation state from
+ *          the render callback is a data race, extract whatever the rendering needs into the snapshot instead.
+ */
+class FramePipeline
+{
+    public:
+
+        using RenderCallback = std::function<RkVoid(RenderSnapshot const&)>;
+
+    private:
+
+        #pragma region Members
+
+        Scheduler&                        m_scheduler;
+        RkUint32                          m_depth;
+        std::unique_ptr<RenderSnapshot[]> m_snapshots;
+        RenderCallback                    m_render_callback;
+
+        // Frames are counted from the start of the pipeline, the next frame to extract is m_extracted_frames
+        // and the next frame to render is m_rendered_frames. The difference is always lower or equal to the depth.
+        std::atomic<RkUint64> m_extracted_frames {0ULL};
+        std::atomic<RkUint64> m_rendered_frames  {0ULL};
+
+        // Set while the driver job is scheduled or running, ensuring a single render driver at any time
+        std::atomic<RkBool> m_render_active {false};
+        CompletionToken     m_driver_token  {};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Renders every extracted snapshot in order, until the rendering caught up with the extraction
+         */
+        RkVoid RenderDriver() noexcept;
+
+        /**
+         * \brief Waits until a given number of frames has been rendered, executing pending jobs in the meantime
+         * \param in_frames_count Number of rendered frames to wait for
+         */
+        RkVoid WaitForRenderedFrames(RkUint64 in_frames_count) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Members
+
+        /**
+         * \brief Invoked on the submitting thread to fill the snapshot of a frame.
+         *        The simulation is not running at this point and can be read freely.
+         */
+        Event<RenderSnapshot&> on_extract {};
+
+        #pragma endregion
+
+        #pragma region Constructors
+
+        /**
+         * \brief Frame pipeline constructor
+         * \param in_scheduler Scheduler running the render driver job
+         * \param in_render_callback Callback rendering a snapshot, this is never invoked concurrently with itself
+         * \param in_depth Maximum number of frames in flight, clamped to at least 1
+         */
+        FramePipeline(Scheduler& in_scheduler, RenderCallback&& in_render_callback, RkUint32 in_depth = RUKEN_FRAME_PIPELINE_DEPTH) noexcept;
+
+        FramePipeline(FramePipeline const& in_copy) = delete;
+        FramePipeline(FramePipeline&&      in_move) = delete;
+        ~FramePipeline() noexcept;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Extracts the snapshot of the frame that has just been simulated and hands it over to the rendering
+         *
+         * This blocks until the pipeline has room for the next frame, ie. until at most depth - 1 frames are still being rendered.
+         * \param in_interpolation_alpha Interpolation factor between the last 2 simulation steps, see FixedTimestep::GetInterpolationAlpha()
+         * \note This must always be called from the same thread, once per frame
+         */
+        RkVoid SubmitFrame(RkFloat in_interpolation_alpha) noexcept;
+
+        /**
+         * \brief Waits until every submitted frame has been rendered
+         * \note This must be called from the submitting thread, and before modifying anything the render callback uses
+         */
+        RkVoid Flush() noexcept;
+
+        /**
+         * \return Maximum number of frames in flight
+         */
+        [[nodiscard]]
+        RkUint32 GetDepth() const noexcept;
+
+        /**
+         * \return Number of frames submitted since the creation of the pipeline
+         */
+        [[nodiscard]]
+        RkUint64 GetSubmittedFramesCount() const noexcept;
+
+        /**
+         * \return Number of frames rendered since the creation of the pipeline
+         */
+        [[nodiscard]]
+        RkUint64 GetRenderedFramesCount() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        FramePipeline& operator=(FramePipeline const& in_copy) = delete;
+        FramePipeline& operator=(FramePipeline&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,147 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <vector>
+#include <typeinfo>
+#include <memory_resource>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+#include "Memory/LinearAllocator.hpp"
+#include "Memory/LinearMemoryResource.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Minimal render state of a frame, extracted out of the simulation once it has been updated.
+ *
+ * The render stage of a frame only reads its snapshot, never the simulation itself,
+ * which allows the simulation of the next frame to run concurrently (see FramePipeline).
+ * Extracted data is stored by type and allocated from the linear storage of the snapshot,
+ * containers stored in the snapshot should allocate from GetMemoryResource() as well.
+ * Everything is released at once when the snapshot is reused for a later frame.
+ */
+class RenderSnapshot
+{
+    private:
+
+        struct Entry
+        {
+            RkSize  type;
+            RkVoid* data;
+            RkVoid  (*destroy)(RkVoid*);
+        };
+
+        #pragma region Members
+
+        RkUint64             m_frame_index         {0ULL};
+        RkFloat              m_interpolation_alpha {0.0F};
+        LinearAllocator      m_allocator;
+        LinearMemoryResource m_memory_resource;
+        std::vector<Entry>   m_entries             {};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Destroys every extracted data and releases the storage
+         */
+        RkVoid Clear() noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        RenderSnapshot() noexcept;
+
+        RenderSnapshot(RenderSnapshot const& in_copy) = delete;
+        RenderSnapshot(RenderSnapshot&&      in_move) = delete;
+        ~RenderSnapshot() noexcept;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Releases the previous content of the snapshot and prepares it for a new frame
+         * \param in_frame_index Index of the new frame
+         * \param in_interpolation_alpha Interpolation factor between the last 2 simulation steps
+         */
+        RkVoid Reset(RkUint64 in_frame_index, RkFloat in_interpolation_alpha) noexcept;
+
+        /**
+         * \brief Constructs some extracted data in the snapshot
+         * \tparam TData Type of the data, only one instance of each type can be stored per snapshot
+         * \param in_args Arguments passed to the constructor of the data
+         * \return Constructed data
+         */
+        template <typename TData, typename... TArgs>
+        TData& Emplace(TArgs&&... in_args) noexcept;
+
+        /**
+         * \brief Looks up some extracted data
+         * \tparam TData Type of the data
+         * \return Found data, nullptr if nothing of this type has been extracted for this frame
+         */
+        template <typename TData>
+        [[nodiscard]]
+        TData const* Find() const noexcept;
+
+        /**
+         * \return Index of the frame of this snapshot
+         */
+        [[nodiscard]]
+        RkUint64 GetFrameIndex() const noexcept;
+
+        /**
+         * \return Interpolation factor between the last 2 simulation steps, see FixedTimestep::GetInterpolationAlpha()
+         */
+        [[nodiscard]]
+        RkFloat GetInterpolationAlpha() const noexcept;
+
+        /**
+         * \return Memory resource allocating from the storage of the snapshot
+         */
+        [[nodiscard]]
+        std::pmr::memory_resource* GetMemoryResource() noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        RenderSnapshot& operator=(RenderSnapshot const& in_copy) = delete;
+        RenderSnapshot& operator=(RenderSnapshot&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+#include "Rendering/RenderSnapshot.inl"
+
+END_RUKEN_NAMESPACE
@@ -30,6 +30,7 @@
 #include "Core/Service.hpp"
 
 #include "Rendering/RenderContext.hpp"
+#include "Rendering/FramePipeline.hpp"
 
 #include "Vulkan/Core/VulkanDevice.hpp"
 #include "Vulkan/Core/VulkanInstance.hpp"
@@ -56,6 +57,7 @@ class Renderer final : public Service<Renderer>
         std::unique_ptr<VulkanDevice>          m_device           {};
         std::unique_ptr<VulkanDeviceAllocator> m_device_allocator {};
         std::vector    <RenderContext>         m_render_contexts  {};
+        std::unique_ptr<FramePipeline>         m_frame_pipeline   {};
 
         #pragma endregion
 
@@ -63,6 +65,13 @@ class Renderer final : public Service<Renderer>
 
         RkVoid MakeContext(Window& in_window) noexcept;
 
+        /**
+         * \brief Renders a frame in every render context
+         * \param in_snapshot Snapshot of the frame to render
+         * \note This is invoked by the frame pipeline, concurrently with the simulation of the next frame
+         */
+        RkVoid Render(RenderSnapshot const& in_snapshot) noexcept;
+
         #pragma endregion
 
     public:
@@ -91,6 +100,12 @@ class Renderer final : public Service<Renderer>
         [[nodiscard]] VulkanDevice&          GetDevice         () const noexcept;
         [[nodiscard]] VulkanDeviceAllocator& GetDeviceAllocator() const noexcept;
 
+        /**
+         * \return Frame pipeline of the renderer, nullptr if the renderer failed to initialize
+         */
+        [[nodiscard]]
+        FramePipeline* GetFramePipeline() const noexcept;
+
         #pragma endregion
 
         #pragma region Operators
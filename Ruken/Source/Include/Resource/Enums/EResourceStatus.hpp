@@ -38,8 +38,10 @@ BEGIN_RUKEN_NAMESPACE
  * Invalid   => The resource has been invalidated, using it in this status might cause crashes.
  *              An invalidation is caused if the resource is tagged for garbage collection (GC)
  *              or if the resource failed to load for any reason.
+ *
+ * \note This is stored on 32 bits so that threads can sleep on the status of a manifest, see Futex
  */
-enum class EResourceStatus : RkUint8
+enum class EResourceStatus : RkUint32
 {
     Pending,
     Processed,
@@ -24,15 +24,19 @@
 
 #pragma once
 
-#include "Utility/Todo.hpp"
-
 #include "Build/Namespace.hpp"
 #include "Types/FundamentalTypes.hpp"
 
 #include "Resource/IResource.hpp"
+#include "Resource/ResourceAwaiter.hpp"
 #include "Resource/ResourceManifest.hpp"
 #include "Resource/Enums/EResourceStatus.hpp"
 
+#include "Threading/Futex.hpp"
+
+#include "Debug/Tracing/TraceScope.hpp"
+
+#include <chrono>
 #include <type_traits>
 
 BEGIN_RUKEN_NAMESPACE
@@ -116,10 +120,11 @@ class Handle
 
         /**
          * \brief Waits until the resource becomes available
+         * \param in_timeout Maximum time to wait for, in seconds. A negative value waits indefinitely
          * \note If the underlying resource manager hasn't been set, this method won't have any effects
-         * \return True if the resource is valid, false otherwise.
+         * \return True if the resource is valid, false if the resource has been invalidated or if the timeout expired.
          */
-        RkBool WaitForValidity(RkFloat in_timeout) const noexcept;
+        RkBool WaitForValidity(RkFloat in_timeout = -1.0F) const noexcept;
 
         /**
          * \brief Returns the garbage collection strategy (get)
@@ -150,6 +155,14 @@ class Handle
         template<typename TDerived>
         explicit operator Handle<TDerived>() const;
 
+        /**
+         * \brief Suspends the awaiting coroutine until the resource becomes available or invalid
+         * \return Awaitable, resuming with true if the resource is available, false otherwise
+         * \see Task
+         */
+        [[nodiscard]]
+        ResourceAwaiter operator co_await() const noexcept;
+
         #pragma endregion
 };
 
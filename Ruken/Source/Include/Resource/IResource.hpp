@@ -24,6 +24,9 @@
 
 #pragma once
 
+#include <span>
+#include <optional>
+
 #include "Build/Namespace.hpp"
 #include "Types/FundamentalTypes.hpp"
 
@@ -60,6 +63,48 @@ class IResource
          * \param in_descriptor Resource loading descriptor. This structure can be inherited to pass custom parameters to the loader
          */
         virtual RkVoid Load(class ResourceManager& in_manager, class ResourceLoadingDescriptor const& in_descriptor) = 0;
+
+        /**
+         * \brief Keeps a copy of the loading descriptor in the resource
+         *
+         * Called by the resource manager before loading the resource asynchronously,
+         * since the descriptor of the request is not guaranteed to outlive the request itself.
+         *
+         * \param in_descriptor Resource loading descriptor of the request
+         * \return Copy of the descriptor, owned by the resource. This is the descriptor then passed to Load()
+         */
+        virtual class ResourceLoadingDescriptor const& KeepLoadingDescriptor(class ResourceLoadingDescriptor const& in_descriptor) noexcept = 0;
+
+        /**
+         * \brief Returns the path of the file the resource is loaded from, if any
+         *
+         * When a path is returned, the resource manager reads the file through the IOService
+         * before calling LoadFromSource(), so that no worker ever blocks on the disk.
+         * This is only called after KeepLoadingDescriptor(), the path must stay valid as long as the kept descriptor.
+         *
+         * \return Path of the source file, or nullptr if the resource should be loaded with Load()
+         */
+        [[nodiscard]]
+        virtual RkChar const* GetSourcePath() const noexcept
+        {
+            return nullptr;
+        }
+
+        /**
+         * \brief Loads the resource from the already read content of its source file
+         *
+         * May be called from any thread.
+         * Only called if GetSourcePath() returned a path, the descriptor is the one kept by KeepLoadingDescriptor().
+         *
+         * \param in_manager Resource manager instance. This is useful to request dependencies or resolve assets name/path.
+         * \param in_source Content of the file returned by GetSourcePath(), or nullopt if it could not be read
+         */
+        virtual RkVoid LoadFromSource(class ResourceManager&                  in_manager,
+                                      std::optional<std::span<RkByte const>> in_source)
+        {
+            (RkVoid)in_manager;
+            (RkVoid)in_source;
+        }
         
         /**
          * \brief Reloads the resource
@@ -0,0 +1,98 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <coroutine>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Resource/Enums/EResourceStatus.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+struct ResourceManifest;
+
+/**
+ * \brief Awaitable returned by co_await handle
+ *
+ * Suspends the awaiting coroutine until the resource is either loaded or invalidated.
+ * The coroutine is then resumed on a worker of the scheduler of the resource manager, see ResourceManager::NotifyWaiters()
+ */
+class ResourceAwaiter
+{
+    private:
+
+        #pragma region Members
+
+        ResourceManifest* m_manifest;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Checks if a status is final, ie. if there is nothing left to wait for
+         * \param in_status Status to check
+         * \return True if the resource is either loaded or invalid
+         */
+        [[nodiscard]]
+        static RkBool IsSettled(EResourceStatus in_status) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        explicit ResourceAwaiter(ResourceManifest* in_manifest) noexcept;
+
+        ResourceAwaiter(ResourceAwaiter const& in_copy) = default;
+        ResourceAwaiter(ResourceAwaiter&&      in_move) = default;
+        ~ResourceAwaiter()                              = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        [[nodiscard]]
+        RkBool await_ready  () const noexcept;
+        RkBool await_suspend(std::coroutine_handle<> in_handle) const noexcept;
+
+        /**
+         * \return True if the resource is available, false if it has been invalidated
+         */
+        RkBool await_resume() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        ResourceAwaiter& operator=(ResourceAwaiter const& in_copy) = delete;
+        ResourceAwaiter& operator=(ResourceAwaiter&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -25,6 +25,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include "Build/Namespace.hpp"
 #include "Types/FundamentalTypes.hpp"
@@ -35,41 +36,99 @@ BEGIN_RUKEN_NAMESPACE
  * \brief Resource Identifier class
  * 
  * A resource identifier is a unique key allowing the identification of a resource.
- * This key is hash-able for fast unordered map access.
+ * The key is the 64 bits FNV-1a hash of the path of the resource, making identifiers trivially copyable
+ * and their comparison and hashing a single integer operation.
+ *
+ * Identifiers of literal paths should be created with FromLiteral(), the path is then hashed at compile time.
+ *
+ * \note If RUKEN_RESOURCE_IDENTIFIER_INTERNING is defined, the paths hashed at runtime are interned
+ *       in a global table to be able to retrieve them for debug messages, see GetName().
+ *       This table is also used to detect hash collisions.
  */
 struct ResourceIdentifier
 {
     #pragma region Variables
 
-    std::string name;
+    RkUint64 hash {0ULL};
 
     #pragma endregion
 
     #pragma region Constructors
 
-    ResourceIdentifier(std::string const& in_name)              noexcept;
-    ResourceIdentifier(ResourceIdentifier const& in_copy) noexcept;
-    ResourceIdentifier(ResourceIdentifier&&         in_move) noexcept;
+    constexpr ResourceIdentifier() noexcept = default;
+
+    /**
+     * \brief Hashes the passed path at runtime, interning it if RUKEN_RESOURCE_IDENTIFIER_INTERNING is defined
+     * \param in_name Path of the resource
+     */
+    explicit ResourceIdentifier(std::string_view in_name) noexcept;
+
+    constexpr ResourceIdentifier(ResourceIdentifier const& in_copy) noexcept = default;
+    constexpr ResourceIdentifier(ResourceIdentifier&&      in_move) noexcept = default;
     ~ResourceIdentifier() = default;
 	
     #pragma endregion
 
+    #pragma region Methods
+
+    /**
+     * \brief Computes the 64 bits FNV-1a hash of a path
+     * \param in_name Path to hash
+     * \return Hash of the path
+     */
+    [[nodiscard]]
+    static constexpr RkUint64 HashName(std::string_view in_name) noexcept;
+
+    /**
+     * \brief Creates an identifier from a literal path, the path is hashed at compile time
+     * \param in_name Path of the resource
+     * \return Resource identifier
+     * \note Since this happens at compile time, the path is never interned
+     */
+    [[nodiscard]]
+    static consteval ResourceIdentifier FromLiteral(std::string_view in_name) noexcept;
+
+    /**
+     * \brief Creates an identifier from an already computed hash
+     * \param in_hash Hash of the path of the resource
+     * \return Resource identifier
+     */
+    [[nodiscard]]
+    static constexpr ResourceIdentifier FromHash(RkUint64 in_hash) noexcept;
+
+    /**
+     * \brief Sets the logger the hash collisions detected while interning are reported to
+     * \param in_logger Logger to use, or nullptr to stop reporting collisions
+     */
+    static RkVoid SetLogger(class Logger* in_logger) noexcept;
+
+    /**
+     * \brief Returns the interned path of the identifier
+     * \return Interned path if any, the hexadecimal representation of the hash otherwise
+     */
+    [[nodiscard]]
+    std::string GetName() const noexcept;
+
+    #pragma endregion
+
     #pragma region Operators
 
     /**
-    * \brief Converts the ResourceIdentifier to a string representation
+    * \brief Converts the ResourceIdentifier to a string representation, see GetName()
     * \return std::string representation
     */
     explicit operator std::string() const noexcept;
 
-    ResourceIdentifier& operator=(ResourceIdentifier const& in_copy) noexcept;
-    ResourceIdentifier& operator=(ResourceIdentifier&&        in_move) noexcept;
+    constexpr ResourceIdentifier& operator=(ResourceIdentifier const& in_copy) noexcept = default;
+    constexpr ResourceIdentifier& operator=(ResourceIdentifier&&      in_move) noexcept = default;
 
-    RkBool operator==(ResourceIdentifier const& in_other) const noexcept;
+    constexpr RkBool operator==(ResourceIdentifier const& in_other) const noexcept;
 
     #pragma endregion
 };
 
+#include "Resource/ResourceIdentifier.inl"
+
 END_RUKEN_NAMESPACE
 
 namespace std
@@ -80,7 +139,7 @@ namespace std
     {
         size_t operator()(RUKEN_NAMESPACE::ResourceIdentifier const& in_identifier) const noexcept
         {
-            return std::hash<std::string>()(in_identifier.name);
+            return static_cast<size_t>(in_identifier.hash);
         }
     };
-}
\ No newline at end of file
+}
@@ -24,8 +24,9 @@
 
 #pragma once
 
+#include <span>
 #include <atomic>
-#include <unordered_map>
+#include <optional>
 
 #include "Build/Namespace.hpp"
 
@@ -34,12 +35,11 @@
 #include "Types/FundamentalTypes.hpp"
 
 #include "Threading/Scheduler.hpp"
-#include "Threading/Synchronized.hpp"
-#include "Threading/SynchronizedAccess.hpp"
 #include "Threading/ESynchronizationMode.hpp"
 
 #include "Resource/Handle.hpp"
 #include "Resource/ResourceIdentifier.hpp"
+#include "Resource/ResourceManifestTable.hpp"
 #include "Resource/Enums/EGCCollectionMode.hpp"
 #include "Resource/Enums/EResourceGCStrategy.hpp"
 
@@ -51,29 +51,55 @@ class ResourceManager final: public Service<ResourceManager>
 
         #pragma region Variables
 
-        // Synchronized map of all the resource manifests
-        Synchronized<std::unordered_map<ResourceIdentifier, struct ResourceManifest*>> m_manifests;
+        // Concurrent map of all the resource manifests, lookups are wait-free
+        ResourceManifestTable m_manifests;
 
         // Integrated garbage collection mode of the resource manager. 
         EGCCollectionMode m_collection_mode;
 
         Scheduler& m_scheduler_reference;
+
+        // Optional, resources with a source file are read through this service when available
+        class IOService* m_io_service;
         
         // The actual number of resource being processed
-        std::atomic<RkUint64> m_current_operation_count;
+        std::atomic<RkUint32> m_current_operation_count;
 
         #pragma endregion
 
-        using ManifestsType        = decltype(m_manifests)::UnderlyingType;
-        using ManifestsReadAccess  = decltype(m_manifests)::ReadAccess;
-        using ManifestsWriteAccess = decltype(m_manifests)::WriteAccess;
-
         #pragma region Methods
 
         RkVoid LoadingRoutine  (struct ResourceManifest* in_manifest, class ResourceLoadingDescriptor const& in_descriptor);
+        RkVoid LoadingRoutine  (struct ResourceManifest* in_manifest, std::optional<std::span<RkByte const>> in_source);
         RkVoid ReloadingRoutine(struct ResourceManifest* in_manifest);
         RkVoid UnloadingRoutine(struct ResourceManifest* in_manifest);
 
+        /**
+         * \brief Settles the status of a manifest around the call of one of its loading methods
+         * \param in_manifest Manifest of the resource to load
+         * \param in_loader Callable invoked with the resource to load
+         */
+        template <typename TLoader_Type>
+        RkVoid ProcessLoading(struct ResourceManifest* in_manifest, TLoader_Type&& in_loader);
+
+        /**
+         * \brief Reads the source file of a resource through the IO service, then loads it from a background job
+         * \param in_manifest Manifest of the resource to load, its loading descriptor must have been kept already
+         * \return False if the resource has no source file or if there is no IO service, in which case nothing has been done
+         */
+        RkBool StreamResource(struct ResourceManifest* in_manifest) noexcept;
+
+        /**
+         * \brief Ends a resource operation, started by incrementing m_current_operation_count
+         */
+        RkVoid EndOperation() noexcept;
+
+        /**
+         * \brief Wakes up everything waiting on the status of a manifest, this must be called after settling the status
+         * \param in_manifest Manifest whose status changed
+         */
+        RkVoid NotifyStatusChange(struct ResourceManifest* in_manifest) noexcept;
+
         /**
          * \brief Invalidates a resource and tags it's corresponding resource manager for garbage collection.
          * \param in_manifest Manifest of the resource to delete
@@ -24,7 +24,10 @@
 
 #pragma once
 
+#include <mutex>
 #include <atomic>
+#include <vector>
+#include <coroutine>
 
 #include "Build/Namespace.hpp"
 #include "Types/FundamentalTypes.hpp"
@@ -32,10 +35,6 @@
 #include "Resource/Enums/EResourceGCStrategy.hpp"
 #include "Resource/ResourceIdentifier.hpp"
 
-#ifndef RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER
-    #define RUKEN_RESOURCE_MANIFEST_DONT_STORE_IDENTIFIER
-#endif
-
 BEGIN_RUKEN_NAMESPACE
 
 /**
@@ -55,10 +54,7 @@ struct ResourceManifest
 
         #pragma region Members
 
-#ifdef RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER
-        // This is only used for debug messages
         const ResourceIdentifier m_identifier;
-#endif
 
         #pragma endregion
 
@@ -80,6 +76,10 @@ struct ResourceManifest
         // Status / availability of the resource
         std::atomic<EResourceStatus> status;
 
+        // Coroutines waiting for the resource to be either loaded or invalidated, see ResourceAwaiter
+        std::mutex                           waiters_mutex;
+        std::vector<std::coroutine_handle<>> waiters;
+
            #pragma endregion
 
         #pragma region Constructors
@@ -97,14 +97,10 @@ struct ResourceManifest
         #pragma region Methods 
 
         /**
-         * \brief Returns the identifier of the manifest, if RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER isn't defined, this will return a default identifier instead
+         * \brief Returns the identifier of the manifest
          * \return Resource identifier
          */
-#ifdef RUKEN_RESOURCE_MANIFEST_STORE_IDENTIFIER
         [[nodiscard]] ResourceIdentifier const& GetIdentifier() const noexcept;
-#else
-        [[nodiscard]] ResourceIdentifier        GetIdentifier() const noexcept;
-#endif
 
         #pragma endregion 
 
@@ -0,0 +1,219 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <bit>
+#include <mutex>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "Build/Config.hpp"
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+#include "Threading/ReadEpoch.hpp"
+
+#include "Resource/ResourceIdentifier.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Concurrent hash table mapping resource identifiers to their manifests, see ResourceManager
+ *
+ * The table is split in shards (RUKEN_RESOURCE_MANIFEST_TABLE_SHARDS), each one being an open addressing table
+ * with linear probing and its own write lock, so that writers only contend if they hit the same shard.
+ * Lookups never lock and are wait-free: they announce a read section (see ReadEpoch) and probe the slots of the shard.
+ *
+ * Removed entries are replaced by tombstones, and shards are rebuilt once too many slots are used.
+ * Removed entries and old slot arrays are retired and destroyed by a later write, once no lookup can access them anymore.
+ *
+ * \note The table never destroys the manifests themselves, this is up to the resource manager
+ */
+class ResourceManifestTable
+{
+    private:
+
+        struct Entry
+        {
+            ResourceIdentifier       identifier;
+            RkSize                   hash     {0ULL};
+            struct ResourceManifest* manifest {nullptr};
+        };
+
+        struct Slots
+        {
+            RkSize                                 capacity {0ULL};
+            std::unique_ptr<std::atomic<Entry*>[]> entries  {nullptr};
+        };
+
+        // Removed entries and replaced slot arrays, destroyed once no reader can access them anymore
+        struct RetiredValue
+        {
+            RkUint64               epoch {0ULL};
+            std::unique_ptr<Entry> entry {nullptr};
+            std::unique_ptr<Slots> slots {nullptr};
+        };
+
+        // Shards are aligned on cache lines to avoid false sharing between the writers of neighbouring shards
+        struct alignas(64) Shard
+        {
+            std::atomic<Slots*>       slots          {nullptr};
+            std::mutex                mutex          {};
+            RkSize                    entries_count  {0ULL};
+            RkSize                    used_count     {0ULL};
+            std::vector<RetiredValue> retired_values {};
+        };
+
+        #pragma region Members
+
+        static_assert(std::has_single_bit(RUKEN_RESOURCE_MANIFEST_TABLE_SHARDS),         "The number of shards must be a power of 2");
+        static_assert(std::has_single_bit(RUKEN_RESOURCE_MANIFEST_TABLE_SHARD_CAPACITY), "The capacity of the shards must be a power of 2");
+
+        static constexpr RkSize shard_bits = std::countr_zero(RUKEN_RESOURCE_MANIFEST_TABLE_SHARDS);
+
+        // Marks the slots of removed entries, lookups keep probing past tombstones
+        inline static Entry m_tombstone {ResourceIdentifier(), 0ULL, nullptr};
+
+        std::array<Shard, RUKEN_RESOURCE_MANIFEST_TABLE_SHARDS> m_shards;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Hashes an identifier
+         * \param in_identifier Identifier to hash
+         * \return Hash of the identifier, the lowest bits select the shard and the others the first slot to probe
+         */
+        [[nodiscard]]
+        static RkSize Hash(ResourceIdentifier const& in_identifier) noexcept;
+
+        /**
+         * \brief Allocates an empty slot array
+         * \param in_capacity Number of slots, must be a power of 2
+         * \return New slot array
+         */
+        [[nodiscard]]
+        static std::unique_ptr<Slots> CreateSlots(RkSize in_capacity) noexcept;
+
+        /**
+         * \brief Rebuilds a shard without its tombstones, growing it if more than half of its slots are in use
+         * \param in_shard Shard to rebuild
+         * \note The lock of the shard must be held
+         */
+        static RkVoid Rebuild(Shard& in_shard) noexcept;
+
+        /**
+         * \brief Removes an entry from a shard
+         * \param in_shard Shard of the entry
+         * \param in_slot Slot of the entry
+         * \note The lock of the shard must be held
+         */
+        static RkVoid Remove(Shard& in_shard, std::atomic<Entry*>& in_slot) noexcept;
+
+        /**
+         * \brief Destroys every retired value of a shard that no reader can access anymore
+         * \param in_shard Shard to reclaim
+         * \note The lock of the shard must be held
+         */
+        static RkVoid DestroyReclaimableValues(Shard& in_shard) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        ResourceManifestTable() noexcept;
+
+        ResourceManifestTable(ResourceManifestTable const& in_copy) = delete;
+        ResourceManifestTable(ResourceManifestTable&&      in_move) = delete;
+        ~ResourceManifestTable() noexcept;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Looks up the manifest of a resource. This is wait-free
+         * \param in_identifier Identifier of the resource
+         * \return Manifest of the resource, or nullptr if there is none
+         */
+        [[nodiscard]]
+        struct ResourceManifest* Find(ResourceIdentifier const& in_identifier) const noexcept;
+
+        /**
+         * \brief Inserts a manifest, unless the resource already has one
+         * \param in_identifier Identifier of the resource
+         * \param in_manifest Manifest to insert
+         * \return Manifest of the resource after the call, if this is not in_manifest, nothing has been inserted
+         */
+        [[nodiscard]]
+        struct ResourceManifest* FindOrInsert(ResourceIdentifier const& in_identifier, struct ResourceManifest* in_manifest) noexcept;
+
+        /**
+         * \brief Invokes a function on every manifest of the table, removing those for which it returned true
+         * \param in_predicate Function taking a manifest pointer and returning a boolean
+         * \note The function is invoked with the lock of the shard held, it must not access the table
+         */
+        template <typename TPredicate>
+        RkVoid EraseIf(TPredicate&& in_predicate) noexcept;
+
+        /**
+         * \brief Invokes a function on every manifest of the table
+         * \param in_function Function taking a manifest pointer
+         * \note The function is invoked with the lock of the shard held, it must not access the table
+         */
+        template <typename TFunction>
+        RkVoid ForEach(TFunction&& in_function) noexcept;
+
+        /**
+         * \brief Removes every manifest from the table
+         */
+        RkVoid Clear() noexcept;
+
+        /**
+         * \brief Returns the number of manifests in the table
+         * \note The size is computed by locking every shard one after the other, this is only meant for debugging
+         * \return Number of manifests
+         */
+        [[nodiscard]]
+        RkSize GetSize() noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        ResourceManifestTable& operator=(ResourceManifestTable const& in_copy) = delete;
+        ResourceManifestTable& operator=(ResourceManifestTable&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+#include "Resource/ResourceManifestTable.inl"
+
+END_RUKEN_NAMESPACE
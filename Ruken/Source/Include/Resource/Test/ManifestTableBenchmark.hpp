@@ -0,0 +1,137 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unordered_map>
+
+#include "Utility/Benchmark.hpp"
+#include "Threading/Synchronized.hpp"
+#include "Threading/SynchronizedAccess.hpp"
+#include "Resource/ResourceManifest.hpp"
+#include "Resource/ResourceManifestTable.hpp"
+
+USING_RUKEN_NAMESPACE
+
+/**
+ * \brief Measures the throughput of the manifest lookups of the resource manager, from 1 to 8 threads.
+ *
+ * Every thread looks up the same number of already existing manifests, in a pseudo random order.
+ * The previous implementation, a single map behind a write lock, is measured as a baseline against ResourceManifestTable.
+ *
+ * \param in_resources_count Number of manifests in the tables
+ * \param in_lookups_count Number of lookups per run, split between the threads
+ */
+inline RkVoid ManifestLookupBenchmark(RkSize const in_resources_count = 4096ULL, RkSize const in_lookups_count = 1ULL << 22ULL) noexcept
+{
+    std::vector<ResourceIdentifier>                identifiers;
+    std::vector<std::unique_ptr<ResourceManifest>> manifests;
+
+    identifiers.reserve(in_resources_count);
+    manifests  .reserve(in_resources_count);
+
+    for (RkSize index = 0ULL; index < in_resources_count; ++index)
+    {
+        identifiers.emplace_back("Resources/Textures/Texture_" + std::to_string(index) + ".png");
+        manifests  .emplace_back(std::make_unique<ResourceManifest>(identifiers.back(), nullptr, EResourceGCStrategy::ReferenceCount));
+    }
+
+    Synchronized<std::unordered_map<ResourceIdentifier, ResourceManifest*>> locked_map;
+    ResourceManifestTable                                                   table;
+
+    {
+        decltype(locked_map)::WriteAccess access(locked_map);
+
+        for (RkSize index = 0ULL; index < in_resources_count; ++index)
+        {
+            access.Get()[identifiers[index]] = manifests[index].get();
+            (RkVoid)table.FindOrInsert(identifiers[index], manifests[index].get());
+        }
+    }
+
+    // Keeps the lookups from being optimized away
+    std::atomic<RkSize> found_count {0ULL};
+
+    // Runs the lookups on their own threads, the calling thread only waits for them
+    auto const run = [&](RkSize const in_threads_count, auto const& in_lookup) {
+        std::vector<std::thread> threads;
+        threads.reserve(in_threads_count);
+
+        for (RkSize thread_index = 0ULL; thread_index < in_threads_count; ++thread_index)
+        {
+            threads.emplace_back([&, thread_index] {
+                RkSize found = 0ULL;
+                RkSize state = thread_index * 0x9e3779b97f4a7c15ULL + 1ULL;
+
+                for (RkSize lookup = 0ULL; lookup < in_lookups_count / in_threads_count; ++lookup)
+                {
+                    // Xorshift, picking a pseudo random identifier
+                    state ^= state << 13ULL;
+                    state ^= state >> 7ULL;
+                    state ^= state << 17ULL;
+
+                    found += in_lookup(identifiers[state % in_resources_count]) != nullptr;
+                }
+
+                found_count.fetch_add(found, std::memory_order_relaxed);
+            });
+        }
+
+        for (std::thread& thread: threads)
+            thread.join();
+    };
+
+    for (RkSize threads_count = 1ULL; threads_count <= 8ULL; threads_count *= 2ULL)
+    {
+        std::string const suffix = " - " + std::to_string(threads_count) + " threads, " + std::to_string(in_lookups_count) + " lookups";
+
+        std::string const locked_label = "Synchronized<std::unordered_map>" + suffix;
+        std::string const table_label  = "ResourceManifestTable"            + suffix;
+
+        BENCHMARK(locked_label)
+        {
+            run(threads_count, [&](ResourceIdentifier const& in_identifier) -> ResourceManifest* {
+                decltype(locked_map)::WriteAccess access(locked_map);
+
+                auto const it = access->find(in_identifier);
+                return it != access->end() ? it->second : nullptr;
+            });
+        }
+
+        BENCHMARK(table_label)
+        {
+            run(threads_count, [&](ResourceIdentifier const& in_identifier) {
+                return table.Find(in_identifier);
+            });
+        }
+    }
+
+    // The table does not own the manifests
+    table.Clear();
+}
@@ -0,0 +1,168 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+#include "Build/Namespace.hpp"
+#include "Threading/CpuRelax.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Blocking adapter over a bounded non-blocking queue (BoundedMpmcQueue or BoundedSpscQueue).
+ *
+ * Enqueue blocks while the queue is full and Dequeue blocks while the queue is empty.
+ * Blocked threads spin for a short while and then park on an atomic wait, which is only notified if a thread is actually parked:
+ * as long as nobody waits, operations cost the same as the underlying queue plus a fence.
+ *
+ * \tparam TQueue Underlying queue type
+ * \tparam TType Type of the items
+ * \note The concurrency guarantees are the ones of the underlying queue,
+ *       a blocking SPSC queue still only supports a single producer and a single consumer
+ */
+template <template <typename> class TQueue, typename TType>
+class BlockingQueue
+{
+    private:
+
+        #pragma region Members
+
+        // Number of attempts spinning, then yielding, before parking a blocked thread
+        static constexpr RkUint32 spin_count  {64U};
+        static constexpr RkUint32 yield_count {8U};
+
+        TQueue<TType> m_queue;
+
+        // Consumers wait on the enqueue epoch, producers on the dequeue one
+        alignas(64) std::atomic<RkUint32> m_enqueue_epoch     {0U};
+        std::atomic<RkUint32>             m_waiting_consumers {0U};
+        alignas(64) std::atomic<RkUint32> m_dequeue_epoch     {0U};
+        std::atomic<RkUint32>             m_waiting_producers {0U};
+        alignas(64) std::atomic<RkBool>   m_released          {false};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Wakes up the threads waiting on an epoch if there are any
+         * \param in_epoch Epoch to advance
+         * \param in_waiting_count Number of threads waiting on the epoch
+         */
+        static RkVoid Notify(std::atomic<RkUint32>& in_epoch, std::atomic<RkUint32> const& in_waiting_count) noexcept;
+
+        /**
+         * \brief Executes an operation, parking the calling thread until it succeeds or until the queue is released
+         * \param in_operation Operation to execute, returns true on success
+         * \param in_epoch Epoch advanced by the operations that can make this one succeed
+         * \param in_waiting_count Number of threads waiting on the epoch
+         * \return True if the operation succeeded, false if the queue has been released
+         */
+        template <typename TOperation>
+        RkBool WaitFor(TOperation&& in_operation, std::atomic<RkUint32>& in_epoch, std::atomic<RkUint32>& in_waiting_count) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \param in_capacity Capacity of the underlying queue
+         */
+        explicit BlockingQueue(RkSize in_capacity) noexcept;
+
+        BlockingQueue(BlockingQueue const& in_copy) = delete;
+        BlockingQueue(BlockingQueue&&      in_move) = delete;
+        ~BlockingQueue()                            = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Enqueues an item, blocking while the queue is full
+         * \param in_item Item to enqueue
+         * \return True if the item has been enqueued, false if the queue has been released
+         */
+        RkBool Enqueue(TType&& in_item) noexcept;
+
+        /**
+         * \brief Dequeues an item, blocking while the queue is empty
+         * \param out_item Dequeued item, only valid if the method returned true
+         * \return True if an item has been dequeued, false if the queue has been released and is empty
+         */
+        RkBool Dequeue(TType& out_item) noexcept;
+
+        /**
+         * \brief Dequeues at least one item and up to the passed count, blocking while the queue is empty
+         * \param out_items Array receiving the dequeued items
+         * \param in_max_count Size of the array
+         * \return Number of dequeued items, 0 if the queue has been released and is empty
+         */
+        RkSize DequeueBatch(TType* out_items, RkSize in_max_count) noexcept;
+
+        /**
+         * \brief Non blocking version of Enqueue
+         * \param in_item Item to enqueue, only moved from if the method returned true
+         * \return True if the item has been enqueued, false if the queue was full
+         */
+        RkBool TryEnqueue(TType&& in_item) noexcept;
+
+        /**
+         * \brief Non blocking version of Dequeue
+         * \param out_item Dequeued item, only valid if the method returned true
+         * \return True if an item has been dequeued, false if the queue was empty
+         */
+        RkBool TryDequeue(TType& out_item) noexcept;
+
+        /**
+         * \brief Releases the queue, unblocking every waiting thread.
+         *        Enqueue fails from now on, while Dequeue keeps returning the remaining items.
+         */
+        RkVoid Release() noexcept;
+
+        /**
+         * \return The underlying queue
+         */
+        [[nodiscard]]
+        TQueue<TType>& GetQueue() noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        BlockingQueue& operator=(BlockingQueue const& in_copy) = delete;
+        BlockingQueue& operator=(BlockingQueue&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+#include "Threading/BlockingQueue.inl"
+
+END_RUKEN_NAMESPACE
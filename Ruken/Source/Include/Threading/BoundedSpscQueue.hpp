@@ -0,0 +1,154 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <new>
+#include <bit>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Bounded wait-free single-producer single-consumer queue.
+ *
+ * The producer only writes the tail index and the consumer only writes the head index, each on its own cache line.
+ * Both sides also cache the last index they read from the other side, so the shared cache line
+ * is only touched when the queue looks full (for the producer) or empty (for the consumer).
+ * Batches publish all their items with a single store.
+ *
+ * \tparam TType Type of the items, must be move constructible
+ * \warning Only one thread may enqueue and only one thread may dequeue at any given time
+ * \see BlockingQueue for a blocking adapter
+ */
+template <typename TType>
+class BoundedSpscQueue
+{
+    private:
+
+        struct Cell
+        {
+            alignas(TType) RkByte storage[sizeof(TType)];
+
+            [[nodiscard]]
+            TType* Item() noexcept;
+        };
+
+        #pragma region Members
+
+        // Consumer side
+        alignas(64) std::atomic<RkSize> m_head        {0ULL};
+        RkSize                          m_cached_tail {0ULL};
+
+        // Producer side
+        alignas(64) std::atomic<RkSize> m_tail        {0ULL};
+        RkSize                          m_cached_head {0ULL};
+
+        alignas(64) std::unique_ptr<Cell[]> m_cells;
+        RkSize const                        m_mask;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \param in_capacity Capacity of the queue, rounded up to the next power of 2
+         */
+        explicit BoundedSpscQueue(RkSize in_capacity) noexcept;
+
+        BoundedSpscQueue(BoundedSpscQueue const& in_copy) = delete;
+        BoundedSpscQueue(BoundedSpscQueue&&      in_move) = delete;
+        ~BoundedSpscQueue() noexcept;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Tries to enqueue an item
+         * \param in_item Item to enqueue, only moved from if the method returned true
+         * \return True if the item has been enqueued, false if the queue was full
+         * \warning This must only be called by the producer
+         */
+        RkBool TryEnqueue(TType&& in_item) noexcept;
+
+        /**
+         * \brief Tries to dequeue an item
+         * \param out_item Dequeued item, only valid if the method returned true
+         * \return True if an item has been dequeued, false if the queue was empty
+         * \warning This must only be called by the consumer
+         */
+        RkBool TryDequeue(TType& out_item) noexcept;
+
+        /**
+         * \brief Enqueues as many items as possible from an array
+         * \param in_items Items to enqueue, the enqueued ones are moved from
+         * \param in_count Number of items in the array
+         * \return Number of enqueued items, these are always the first items of the array
+         * \warning This must only be called by the producer
+         */
+        RkSize TryEnqueueBatch(TType* in_items, RkSize in_count) noexcept;
+
+        /**
+         * \brief Dequeues as many items as possible into an array
+         * \param out_items Array receiving the dequeued items
+         * \param in_max_count Size of the array
+         * \return Number of dequeued items
+         * \warning This must only be called by the consumer
+         */
+        RkSize TryDequeueBatch(TType* out_items, RkSize in_max_count) noexcept;
+
+        /**
+         * \return Capacity of the queue
+         */
+        [[nodiscard]]
+        RkSize GetCapacity() const noexcept;
+
+        /**
+         * \brief Returns an estimation of the number of items in the queue
+         * \return Approximate size of the queue
+         */
+        [[nodiscard]]
+        RkSize GetApproximateSize() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        BoundedSpscQueue& operator=(BoundedSpscQueue const& in_copy) = delete;
+        BoundedSpscQueue& operator=(BoundedSpscQueue&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+#include "Threading/BoundedSpscQueue.inl"
+
+END_RUKEN_NAMESPACE
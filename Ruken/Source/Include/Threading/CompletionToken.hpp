@@ -0,0 +1,106 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Counts the unfinished jobs of a group of jobs, see Scheduler::Wait()
+ *
+ * Jobs scheduled with a token are added to it when scheduled, and complete it once executed (or dropped by a shutdown).
+ * A token can be reused as soon as it is complete.
+ *
+ * The thread completing the last job still notifies the waiting threads after the count dropped to zero,
+ * the state thus also counts the threads currently completing the token. A token is only considered
+ * complete once none of them is left, which makes it safe to destroy a token as soon as Wait() returns.
+ */
+class CompletionToken
+{
+    private:
+
+        #pragma region Members
+
+        // Low half: number of pending jobs, high half: number of threads currently completing a job
+        static constexpr RkUint64 completer_unit = 1ULL << 32ULL;
+        static constexpr RkUint64 pending_mask   = completer_unit - 1ULL;
+
+        std::atomic<RkUint64> m_state {0ULL};
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        CompletionToken() = default;
+
+        CompletionToken(CompletionToken const& in_copy) = delete;
+        CompletionToken(CompletionToken&&      in_move) = delete;
+        ~CompletionToken()                              = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Adds some pending jobs to the token
+         * \param in_count Number of jobs to add
+         */
+        RkVoid Add(RkUint32 in_count = 1U) noexcept;
+
+        /**
+         * \brief Marks one of the pending jobs as done, waking up the waiting threads if this was the last one
+         */
+        RkVoid Complete() noexcept;
+
+        /**
+         * \brief Checks if every job of the token is done
+         * \return True if the token is complete
+         */
+        [[nodiscard]]
+        RkBool IsComplete() const noexcept;
+
+        /**
+         * \brief Blocks the calling thread until the token is complete, without executing anything
+         * \see Scheduler::Wait() to execute jobs while waiting
+         */
+        RkVoid Wait() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        CompletionToken& operator=(CompletionToken const& in_copy) = delete;
+        CompletionToken& operator=(CompletionToken&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,251 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <type_traits>
+
+#include "Build/Namespace.hpp"
+
+#include "Threading/ReadEpoch.hpp"
+#include "Threading/EAccessMode.hpp"
+#include "Threading/Synchronized.hpp"
+#include "Threading/ESynchronizationPolicy.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+// Forward declaration
+template<class, EAccessMode>
+class CopyOnWriteAccess;
+
+/**
+ * \brief Copy on write (RCU like) specialization of the Synchronized class
+ * \tparam TType Type of the synchronized value, must be copy constructible
+ *
+ * Readers access the currently published snapshot of the value without any lock,
+ * the only write they do is announcing their read section in a cache line owned by their thread (see ReadEpoch).
+ * Writers are serialized, modify a private copy of the value and publish it once done.
+ * The previous snapshot is retired and destroyed by a later write once no reader can access it anymore.
+ *
+ * \note Every write copies the whole value, this is meant for read-mostly data like lookup tables
+ */
+template<typename TType>
+class Synchronized<TType, ESynchronizationPolicy::CopyOnWrite>
+{
+    template<class, EAccessMode> friend class CopyOnWriteAccess;
+
+    public:
+
+        using ReadAccess     = CopyOnWriteAccess<TType, EAccessMode::Read >;
+        using WriteAccess    = CopyOnWriteAccess<TType, EAccessMode::Write>;
+        using UnderlyingType = TType;
+
+    private:
+
+        struct RetiredValue
+        {
+            RkUint64                     epoch {0ULL};
+            std::unique_ptr<TType const> value {nullptr};
+        };
+
+        #pragma region Variables
+
+        std::atomic<TType const*> m_value;
+
+        // Only accessed by writers
+        std::mutex                m_write_mutex    {};
+        std::vector<RetiredValue> m_retired_values {};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Publishes a new value, retiring the current one
+         * \param in_value New value
+         * \note The write mutex must be locked
+         */
+        RkVoid Publish(std::unique_ptr<TType> in_value) noexcept;
+
+        /**
+         * \brief Destroys every retired value no reader can access anymore
+         * \note The write mutex must be locked
+         */
+        RkVoid DestroyReclaimableValues() noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \brief Constructs the content of the synchronized object using the following constructor: Type(Args...)
+         * \tparam TArgs Arguments type
+         * \param in_args arguments
+         */
+        template <typename ...TArgs, typename = std::enable_if_t<std::is_constructible_v<TType, TArgs...>>>
+        Synchronized(TArgs... in_args);
+
+        Synchronized();
+        Synchronized(Synchronized const& in_copy) = delete;
+        Synchronized(Synchronized&&      in_move) = delete;
+        ~Synchronized() noexcept;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Destroys every retired snapshot no reader can access anymore
+         * \note This is done on every write, calling this is only useful to release memory after a burst of writes
+         */
+        RkVoid Reclaim() noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        Synchronized& operator=(Synchronized const& in_copy) = delete;
+        Synchronized& operator=(Synchronized&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+/**
+ * \brief Allows safe accesses to a copy on write Synchronized object using the RAII principle
+ * \brief Read access specialization, the accessed snapshot stays alive as long as the access does
+ *
+ * \tparam TData Synchronized object's type
+ */
+template<class TData, EAccessMode TMode>
+class CopyOnWriteAccess
+{
+    static_assert(TMode == EAccessMode::Read, "The copy on write policy only supports read and write accesses");
+
+    private:
+
+        #pragma region Members
+
+        TData const* m_value;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        CopyOnWriteAccess(Synchronized<TData, ESynchronizationPolicy::CopyOnWrite> const& in_synchronized) noexcept;
+
+        CopyOnWriteAccess(CopyOnWriteAccess const& in_copy) = delete;
+        CopyOnWriteAccess(CopyOnWriteAccess&&      in_move) = delete;
+        ~CopyOnWriteAccess() noexcept;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Synchronized getter
+         * \return Snapshot of the synchronized object's content
+         */
+        [[nodiscard]]
+        TData const& Get() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        CopyOnWriteAccess& operator=(CopyOnWriteAccess const& in_copy) = delete;
+        CopyOnWriteAccess& operator=(CopyOnWriteAccess&&      in_move) = delete;
+
+        [[nodiscard]] TData const& operator* () const noexcept;
+        [[nodiscard]] TData const* operator->() const noexcept;
+
+        #pragma endregion
+};
+
+/**
+ * \brief Allows safe accesses to a copy on write Synchronized object using the RAII principle
+ * \brief Write access specialization, works on a copy of the value published when the access is destroyed
+ *
+ * \tparam TData Synchronized object's type
+ */
+template<class TData>
+class CopyOnWriteAccess<TData, EAccessMode::Write>
+{
+    private:
+
+        #pragma region Members
+
+        Synchronized<TData, ESynchronizationPolicy::CopyOnWrite>& m_synchronized;
+        std::unique_lock<std::mutex>                              m_lock;
+        std::unique_ptr<TData>                                    m_value;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        CopyOnWriteAccess(Synchronized<TData, ESynchronizationPolicy::CopyOnWrite>& in_synchronized);
+
+        CopyOnWriteAccess(CopyOnWriteAccess const& in_copy) = delete;
+        CopyOnWriteAccess(CopyOnWriteAccess&&      in_move) = delete;
+        ~CopyOnWriteAccess() noexcept;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Synchronized getters
+         * \return Synchronized's object content
+         */
+        [[nodiscard]] TData&       Get()       noexcept;
+        [[nodiscard]] TData const& Get() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        CopyOnWriteAccess& operator=(CopyOnWriteAccess const& in_copy) = delete;
+        CopyOnWriteAccess& operator=(CopyOnWriteAccess&&      in_move) = delete;
+
+        [[nodiscard]] TData&       operator* ()       noexcept;
+        [[nodiscard]] TData const& operator* () const noexcept;
+
+        [[nodiscard]] TData*       operator->()       noexcept;
+        [[nodiscard]] TData const* operator->() const noexcept;
+
+        #pragma endregion
+};
+
+#include "Threading/CopyOnWriteSynchronized.inl"
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,57 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include "Build/Compiler.hpp"
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+#if defined(RUKEN_COMPILER_MSVC)
+    #include <intrin.h>
+#endif
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Hints the processor that the calling thread is spin waiting
+ *
+ * On x86 this emits a pause instruction, which saves some power, frees execution resources
+ * for the sibling hyper-thread and avoids a memory order violation penalty when leaving the spin loop.
+ * \note This does nothing on unsupported architectures
+ */
+inline RkVoid CpuRelax() noexcept
+{
+    #if defined(RUKEN_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+    #elif defined(RUKEN_COMPILER_MSVC) && defined(_M_ARM64)
+        __yield();
+    #elif defined(RUKEN_COMPILER_GCC) && (defined(__x86_64__) || defined(__i386__))
+        __builtin_ia32_pause();
+    #elif defined(RUKEN_COMPILER_GCC) && defined(__aarch64__)
+        asm volatile("yield" ::: "memory");
+    #endif
+}
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,109 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Threading/LogicalProcessor.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Describes the logical processors available to the process, their physical cores and their numa nodes
+ *
+ * The topology is queried from the operating system once, at construction.
+ * Only the processors the process is allowed to run on are listed.
+ * If the query fails, every hardware thread is reported as its own core on a single numa node.
+ */
+class CpuTopology
+{
+    private:
+
+        #pragma region Members
+
+        std::vector<LogicalProcessor> m_processors       {};
+        RkUint32                      m_cores_count      {0U};
+        RkUint32                      m_numa_nodes_count {1U};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Fills the processors from the operating system
+         * \return True if the query succeeded
+         */
+        RkBool QueryProcessors() noexcept;
+
+        /**
+         * \brief Makes the core and numa node indices contiguous, and computes the SMT index of every processor
+         */
+        RkVoid Normalize() noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        CpuTopology() noexcept;
+
+        CpuTopology(CpuTopology const& in_copy) = default;
+        CpuTopology(CpuTopology&&      in_move) = default;
+        ~CpuTopology()                          = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        // Getters
+        [[nodiscard]] std::vector<LogicalProcessor> const& GetLogicalProcessors() const noexcept;
+        [[nodiscard]] RkUint32                             GetCoresCount       () const noexcept;
+        [[nodiscard]] RkUint32                             GetNumaNodesCount   () const noexcept;
+
+        /**
+         * \brief Returns the processors in the order threads should be placed on them
+         *
+         * Processors are ordered numa node by numa node, so that consecutive threads share the same memory.
+         * Inside of a node, the first hardware thread of every core comes before any SMT sibling.
+         * \param in_skip_smt_siblings If true, only the first hardware thread of every core is returned
+         * \return Ordered processors
+         */
+        [[nodiscard]]
+        std::vector<LogicalProcessor> GetPlacementOrder(RkBool in_skip_smt_siblings) const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        CpuTopology& operator=(CpuTopology const& in_copy) = default;
+        CpuTopology& operator=(CpuTopology&&      in_move) = default;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,50 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Describes how a Synchronized object protects its value
+ *
+ * SharedMutex => Readers and writers lock a shared mutex. Works with any type but every access,
+ *                even a read, writes to the mutex and thus bounces its cache line between cores.
+ * SeqLock     => Readers copy the value without writing anything and retry if a write happened meanwhile.
+ *                Reserved to small trivially copyable values read much more often than written.
+ * CopyOnWrite => Readers access an immutable snapshot of the value, writers publish a modified copy.
+ *                Old snapshots are reclaimed once no reader can access them anymore (see ReadEpoch).
+ *                Meant for read-mostly containers.
+ */
+enum class ESynchronizationPolicy : RkUint8
+{
+    SharedMutex,
+    SeqLock,
+    CopyOnWrite
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,142 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+#include "Threading/EEventResetMode.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Lightweight event, waiting threads sleep on a futex until the event is set
+ *
+ * The state of the event and its number of waiting threads are packed in a single word, this way Set()
+ * only issues a system call if someone is actually waiting, and never touches the event once it has been set.
+ * It is thus safe to destroy an event as soon as the last waiting thread has been released.
+ *
+ * \see EEventResetMode
+ */
+class Event
+{
+    private:
+
+        #pragma region Members
+
+        // Lowest bit: signaled flag, remaining bits: number of waiting threads
+        static constexpr RkUint32 signaled_bit = 1U;
+        static constexpr RkUint32 waiter_unit  = 2U;
+
+        EEventResetMode       m_reset_mode;
+        std::atomic<RkUint32> m_state;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Tries to get released by the event without waiting
+         * \param io_state Last known state of the event, updated if the state changed in the meantime
+         * \return True if the calling thread has been released
+         */
+        RkBool TryAcquire(RkUint32& io_state) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        explicit Event(EEventResetMode in_reset_mode = EEventResetMode::Manual, RkBool in_signaled = false) noexcept;
+
+        Event(Event const& in_copy) = delete;
+        Event(Event&&      in_move) = delete;
+        ~Event()                    = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Sets the event, releasing every waiting thread in manual mode, or a single one in automatic mode
+         */
+        RkVoid Set() noexcept;
+
+        /**
+         * \brief Resets the event, threads calling any of the wait methods will block until the event is set again
+         */
+        RkVoid Reset() noexcept;
+
+        /**
+         * \brief Checks if the event is set
+         * \return True if the event is set
+         */
+        [[nodiscard]]
+        RkBool IsSet() const noexcept;
+
+        /**
+         * \brief Checks if the event is set, without blocking
+         * \note This consumes the event in automatic mode
+         * \return True if the calling thread has been released
+         */
+        [[nodiscard]]
+        RkBool TryWait() noexcept;
+
+        /**
+         * \brief Blocks the calling thread until the event is set
+         */
+        RkVoid Wait() noexcept;
+
+        /**
+         * \brief Blocks the calling thread until the event is set, or until the timeout expires
+         * \param in_timeout Maximum time to wait for
+         * \return True if the calling thread has been released, false if the timeout expired
+         */
+        [[nodiscard]]
+        RkBool WaitFor(std::chrono::nanoseconds in_timeout) noexcept;
+
+        /**
+         * \brief Blocks the calling thread until the event is set, or until the deadline is reached
+         * \param in_deadline Deadline, std::chrono::steady_clock::time_point::max() waits indefinitely
+         * \return True if the calling thread has been released, false if the deadline has been reached
+         */
+        [[nodiscard]]
+        RkBool WaitUntil(std::chrono::steady_clock::time_point in_deadline) noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        Event& operator=(Event const& in_copy) = delete;
+        Event& operator=(Event&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
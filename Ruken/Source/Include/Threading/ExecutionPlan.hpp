@@ -1,4 +1,4 @@
-﻿/*
+/*
  *  MIT License
  *
  *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
@@ -24,9 +24,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <vector>
+#include <utility>
 
 #include "Threading/Job.hpp"
+#include "Threading/CompletionToken.hpp"
 #include "Build/Namespace.hpp"
 #include "Types/FundamentalTypes.hpp"
 
@@ -34,28 +38,135 @@ BEGIN_RUKEN_NAMESPACE
 
 class Scheduler;
 
+/**
+ * \brief Reusable graph of jobs.
+ *
+ * Every instruction of the plan is a node of the graph, holding an atomic counter of its unfinished predecessors.
+ * Once an instruction is done, the counters of its successors are decremented and every successor that became
+ * ready is pushed to the scheduler (the first one is directly executed by the same thread instead).
+ * This way, no worker ever blocks waiting on a dependency.
+ * Instructions can be given a skip predicate, evaluated once the instruction is ready. Skipped instructions are
+ * completed inline like join nodes, without costing a job.
+ *
+ * The graph is compiled once, the first time the plan is executed after being modified.
+ * Executing the same plan over and over again (typically once per frame) does not allocate any memory.
+ *
+ * If the scheduler is in deterministic mode (see Scheduler::SetDeterministicMode()), a topological order is first drawn
+ * from the seed of the scheduler and from the number of executions of the plan. This order is recorded, see GetExecutionOrder().
+ * The counters are then used the same way, except that ready instructions are not pushed by the thread completing
+ * their last predecessor: the calling thread releases them to the scheduler one by one, in the recorded order,
+ * waiting for each of them to be ready. Independent instructions thus still run in parallel on every worker,
+ * but always start in the same order for a given seed.
+ */
 class ExecutionPlan
 {
+    public:
+
+        /**
+         * \brief Predicate telling if an instruction has nothing to do this time, see AddInstruction()
+         * \param in_context Context passed along with the predicate
+         * \return True if the instruction must be skipped
+         */
+        using SkipPredicate = RkBool (*)(RkVoid* in_context) noexcept;
+
     private:
 
+        struct Node
+        {
+            // Empty for the join nodes created by EndInstructionPack(), these are completed inline
+            Job           instruction  {};
+            RkChar const* name         {nullptr};
+            SkipPredicate skip         {nullptr};
+            RkVoid*       skip_context {nullptr};
+
+            RkSize predecessors_count {0ULL};
+            RkSize successors_offset  {0ULL};
+            RkSize successors_count   {0ULL};
+        };
+
         #pragma region Members
 
         // Plan status, only used when constructing the plan
-        RkSize m_current_pack_size {0ULL};
+        std::vector<RkSize>                    m_current_pack {};
+        RkSize                                 m_pack_join    {invalid_node};
+        std::vector<std::pair<RkSize, RkSize>> m_edges        {};
+        RkBool                                 m_compiled     {true};
+
+        // Compiled graph, successors of every node are stored contiguously in m_successors
+        std::vector<Node>   m_nodes      {};
+        std::vector<RkSize> m_successors {};
+        std::vector<RkSize> m_roots      {};
+
+        // Execution state, reset before every execution
+        std::unique_ptr<std::atomic<RkSize>[]> m_pending_predecessors {};
+        CompletionToken                        m_remaining_nodes      {};
+        Scheduler*                             m_scheduler            {nullptr};
+
+        // Deterministic execution state, the order of the last execution is kept as a record.
+        // An instruction waiting for its predecessors holds one pending job in its ready token
+        std::vector<RkSize>                m_execution_order    {};
+        std::vector<RkSize>                m_ready_nodes        {};
+        std::unique_ptr<CompletionToken[]> m_ready_tokens       {};
+        RkUint64                           m_executions_count   {0ULL};
+        RkBool                             m_releases_in_order  {false};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Builds the successors lists, the roots and the counters of the graph from the recorded edges
+         */
+        RkVoid CompilePlan() noexcept;
+
+        /**
+         * \brief Checks if a ready node has an instruction to execute, ie. if it is neither a join node nor skipped
+         * \param in_node Node to check
+         * \return True if the instruction of the node must be executed
+         */
+        [[nodiscard]]
+        static RkBool RequiresExecution(Node const& in_node) noexcept;
+
+        /**
+         * \brief Schedules the execution of a ready node, join nodes and skipped nodes are completed right away
+         * \param in_node Index of the node
+         */
+        RkVoid ScheduleNode(RkSize in_node) noexcept;
+
+        /**
+         * \brief Releases the instructions to the scheduler in the recorded order, once each of them is ready
+         * \param in_scheduler Scheduler executing the plan
+         */
+        RkVoid ReleaseInOrder(Scheduler& in_scheduler) noexcept;
+
+        /**
+         * \brief Executes a ready node, and then any successor it made ready until none is left
+         * \param in_node Index of the node
+         * \param in_execute False if the instruction of the node must not be executed, see RequiresExecution()
+         */
+        RkVoid ExecuteNode(RkSize in_node, RkBool in_execute) noexcept;
 
-        // Execution instructions (aka. the actual update plan)
-        std::vector<RkSize> m_packs        {};
-        std::vector<Job>    m_instructions {};
+        /**
+         * \brief Draws a topological order of the instructions, ready instructions are picked at random
+         * \param in_seed Seed of the order, the same seed always gives the same order for a given plan
+         */
+        RkVoid BuildExecutionOrder(RkUint64 in_seed) noexcept;
 
         #pragma endregion
 
     public:
 
+        #pragma region Members
+
+        static constexpr RkSize invalid_node = static_cast<RkSize>(-1);
+
+        #pragma endregion
+
         #pragma region Constructors
 
         ExecutionPlan()                             = default;
-        ExecutionPlan(ExecutionPlan const& in_copy) = default;
-        ExecutionPlan(ExecutionPlan&&      in_move) = default;
+        ExecutionPlan(ExecutionPlan const& in_copy) = delete;
+        ExecutionPlan(ExecutionPlan&&      in_move) = delete;
         ~ExecutionPlan()                            = default;
 
         #pragma endregion
@@ -70,8 +181,25 @@ class ExecutionPlan
         /**
          * \brief Adds an instruction to the plan (in the current instruction pack)
          * \param in_instruction Job
+         * \param in_name Name of the instruction, only used to trace the execution of the plan (see Tracer). Must outlive the plan
+         * \param in_skip Optional predicate, evaluated every time the instruction becomes ready.
+         *                If it returns true, the instruction is completed right away without being executed
+         * \param in_skip_context Context passed to the skip predicate
+         * \return Index of the instruction node, can be used to declare additional dependencies
+         */
+        RkSize AddInstruction(Job&&         in_instruction,
+                              RkChar const* in_name         = "Instruction",
+                              SkipPredicate in_skip         = nullptr,
+                              RkVoid*       in_skip_context = nullptr) noexcept;
+
+        /**
+         * \brief Declares that an instruction can only start once another one is done
+         * \param in_predecessor Instruction that must be done first
+         * \param in_successor Dependent instruction
+         * \note Instructions can only depend on previously added instructions, cycles are thus impossible.
+         *       Passing a successor added before its predecessor, or an unknown instruction, asserts
          */
-        RkVoid AddInstruction(Job&& in_instruction) noexcept;
+        RkVoid AddDependency(RkSize in_predecessor, RkSize in_successor) noexcept;
 
         /**
          * \brief Ends the current instruction pack, effectively creating a
@@ -80,24 +208,40 @@ class ExecutionPlan
         RkVoid EndInstructionPack() noexcept;
 
         /**
-         * \brief Starts an asynchronous execution of the plan
+         * \brief Executes the plan on the workers of a scheduler and returns once every instruction is done
          * \param in_scheduler Scheduler
+         * \note The calling thread executes jobs until the plan completes, see Scheduler::Wait()
          */
-        RkVoid ExecutePlanAsynchronously(Scheduler& in_scheduler) const noexcept;
+        RkVoid ExecutePlanAsynchronously(Scheduler& in_scheduler) noexcept;
 
         /**
          * \brief Starts a synchronous execution of the plan
          */
         RkVoid ExecutePlanSynchronously() const noexcept;
 
+        /**
+         * \brief Returns the order in which the instructions have been released by the last deterministic execution
+         * \return Instruction indices, in execution order. Empty if the plan has never been executed in deterministic mode
+         */
+        [[nodiscard]]
+        std::vector<RkSize> const& GetExecutionOrder() const noexcept;
+
+        /**
+         * \brief Returns the name of an instruction, mostly meant to print the execution order
+         * \param in_instruction Index of the instruction
+         * \return Name of the instruction, see AddInstruction()
+         */
+        [[nodiscard]]
+        RkChar const* GetInstructionName(RkSize in_instruction) const noexcept;
+
         #pragma endregion
 
         #pragma region Operators
 
-        ExecutionPlan& operator=(ExecutionPlan const& in_copy) = default;
-        ExecutionPlan& operator=(ExecutionPlan&&      in_move) = default;
+        ExecutionPlan& operator=(ExecutionPlan const& in_copy) = delete;
+        ExecutionPlan& operator=(ExecutionPlan&&      in_move) = delete;
 
         #pragma endregion
 };
 
-END_RUKEN_NAMESPACE
\ No newline at end of file
+END_RUKEN_NAMESPACE
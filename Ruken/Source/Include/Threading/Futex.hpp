@@ -0,0 +1,146 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <bit>
+#include <atomic>
+#include <chrono>
+#include <type_traits>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Types that can be waited on by the Futex class, the OS only knows how to wait on 32 bits words
+ */
+template <typename TType>
+concept FutexWordType = sizeof(TType) == sizeof(RkUint32) && std::is_trivially_copyable_v<TType> && std::atomic<TType>::is_always_lock_free;
+
+/**
+ * \brief Waits and wakes threads on 32 bits atomic words, directly through the OS
+ *        (futex on Linux, WaitOnAddress on Windows)
+ *
+ * This is what std::atomic::wait() does under the hood, except that waits can be bounded by a timeout.
+ * Waiting threads can return spuriously, callers are expected to check their condition again in a loop.
+ *
+ * \note Threads waiting through this class must be woken up through this class as well,
+ *       std::atomic::notify_one() and notify_all() are not guaranteed to wake them up.
+ * \note Waking up a word only touches its address, and never reads its content.
+ *       It is thus safe to destroy a word as soon as a waiter observed the change, even if the waker is still waking it up.
+ */
+class Futex
+{
+    private:
+
+        #pragma region Methods
+
+        /**
+         * \brief Blocks the calling thread as long as the word at the given address holds the expected value
+         * \param in_address Address of the word
+         * \param in_expected Expected value
+         * \param in_timeout Timeout in nanoseconds, a negative value waits indefinitely
+         * \return False if the timeout expired, true otherwise
+         */
+        static RkBool WaitOnWord(RkVoid const* in_address, RkUint32 in_expected, RkInt64 in_timeout) noexcept;
+
+        /**
+         * \brief Wakes up the threads waiting on the word at the given address
+         * \param in_address Address of the word
+         * \param in_wake_all True to wake up every waiting thread, false to wake up a single one
+         */
+        static RkVoid WakeWord(RkVoid const* in_address, RkBool in_wake_all) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        Futex()                     = delete;
+        Futex(Futex const& in_copy) = delete;
+        Futex(Futex&&      in_move) = delete;
+        ~Futex()                    = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Blocks the calling thread as long as the word holds the expected value
+         * \param in_word Word to wait on
+         * \param in_expected Expected value, the thread does not block if the word holds another value
+         */
+        template <FutexWordType TType>
+        static RkVoid Wait(std::atomic<TType> const& in_word, TType in_expected) noexcept;
+
+        /**
+         * \brief Blocks the calling thread as long as the word holds the expected value, or until the timeout expires
+         * \param in_word Word to wait on
+         * \param in_expected Expected value, the thread does not block if the word holds another value
+         * \param in_timeout Maximum time to wait for
+         * \return False if the timeout expired, true otherwise
+         */
+        template <FutexWordType TType>
+        static RkBool WaitFor(std::atomic<TType> const& in_word, TType in_expected, std::chrono::nanoseconds in_timeout) noexcept;
+
+        /**
+         * \brief Blocks the calling thread as long as the word holds the expected value, or until the deadline is reached
+         * \param in_word Word to wait on
+         * \param in_expected Expected value, the thread does not block if the word holds another value
+         * \param in_deadline Deadline, std::chrono::steady_clock::time_point::max() waits indefinitely
+         * \return False if the deadline has been reached, true otherwise
+         */
+        template <FutexWordType TType>
+        static RkBool WaitUntil(std::atomic<TType> const& in_word, TType in_expected, std::chrono::steady_clock::time_point in_deadline) noexcept;
+
+        /**
+         * \brief Wakes up one of the threads waiting on the word
+         * \param in_word Word to wake up
+         */
+        template <FutexWordType TType>
+        static RkVoid WakeOne(std::atomic<TType> const& in_word) noexcept;
+
+        /**
+         * \brief Wakes up every thread waiting on the word
+         * \param in_word Word to wake up
+         */
+        template <FutexWordType TType>
+        static RkVoid WakeAll(std::atomic<TType> const& in_word) noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        Futex& operator=(Futex const& in_copy) = delete;
+        Futex& operator=(Futex&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+#include "Threading/Futex.inl"
+
+END_RUKEN_NAMESPACE
@@ -24,13 +24,106 @@
 
 #pragma once
 
-#include <functional>
+#include <new>
+#include <utility>
+#include <concepts>
+#include <type_traits>
 
 #include "Build/Namespace.hpp"
 #include "Types/FundamentalTypes.hpp"
 
 BEGIN_RUKEN_NAMESPACE
 
-using Job = std::function<RkVoid()>;
+/**
+ * \brief Move only, type erased callable, exactly one cache line wide.
+ *
+ * Unlike std::function, the captures of the callable are always stored inline and a job never allocates.
+ * Callables that do not fit into the inline storage are rejected at compile time,
+ * capture a pointer to a bigger structure instead.
+ */
+class alignas(64) Job
+{
+    public:
+
+        static constexpr RkSize size         = 64ULL;
+        static constexpr RkSize storage_size = size - 2ULL * sizeof(RkVoid*);
+
+    private:
+
+        // Invokes the callable stored in the passed storage
+        using Invoker = RkVoid (*)(RkVoid* in_storage);
+
+        // Move constructs the callable of in_source into in_destination (if not null) and destroys the callable of in_source
+        using Manager = RkVoid (*)(RkVoid* in_destination, RkVoid* in_source);
+
+        #pragma region Members
+
+        alignas(16) mutable RkByte m_storage[storage_size];
+
+        Invoker m_invoker {nullptr};
+        Manager m_manager {nullptr};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        template <typename TCallable>
+        static RkVoid Invoke(RkVoid* in_storage) noexcept;
+
+        template <typename TCallable>
+        static RkVoid Manage(RkVoid* in_destination, RkVoid* in_source) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        Job() noexcept = default;
+
+        /**
+         * \brief Creates a job from a callable
+         * \tparam TCallable Callable type, must fit into the inline storage of the job
+         * \param in_callable Callable to store
+         */
+        template <typename TCallable> requires (!std::same_as<std::remove_cvref_t<TCallable>, Job> && std::invocable<std::remove_cvref_t<TCallable>&>)
+        Job(TCallable&& in_callable) noexcept;
+
+        Job(Job const& in_copy) = delete;
+        Job(Job&&      in_move) noexcept;
+        ~Job() noexcept;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Destroys the stored callable, if any, leaving the job empty
+         */
+        RkVoid Reset() noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        /**
+         * \brief Invokes the stored callable, the job must not be empty
+         */
+        RkVoid operator()() const noexcept;
+
+        /**
+         * \brief Checks if the job holds a callable
+         */
+        explicit operator bool() const noexcept;
+
+        Job& operator=(Job const& in_copy) = delete;
+        Job& operator=(Job&&      in_move) noexcept;
+
+        #pragma endregion
+};
+
+static_assert(sizeof(Job) == Job::size, "A job must be exactly one cache line wide");
+
+#include "Threading/Job.inl"
 
-END_RUKEN_NAMESPACE
\ No newline at end of file
+END_RUKEN_NAMESPACE
@@ -0,0 +1,117 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "Build/Namespace.hpp"
+#include "Threading/Job.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+class CompletionToken;
+
+/**
+ * \brief Job allocated by a JobPool
+ * \note The state of the job lives on its own cache line, this way,
+ *       releasing a job never invalidates the cache line of a neighbour job
+ */
+struct PooledJob
+{
+    Job                             job          {};
+    alignas(64) std::atomic<RkBool> busy         {false};
+    RkBool                          pooled       {true};
+    CompletionToken*                token        {nullptr};
+    RkUint64                        enqueue_time {0ULL}; // Scheduling timestamp, see WorkerCounters::GetTimestamp
+};
+
+/**
+ * \brief Ring of preallocated jobs, allowing the submission of jobs without any heap allocation.
+ *
+ * Jobs are acquired by a single owner, walking the ring in order, and can be released by any thread.
+ * Since jobs can complete out of order, the owner skips a few busy jobs before giving up.
+ * If no free job could be found, the job is allocated on the heap instead, this only happens
+ * when more jobs than the capacity of the pool are in flight at once.
+ */
+class JobPool
+{
+    private:
+
+        #pragma region Members
+
+        std::unique_ptr<PooledJob[]> m_ring   {};
+        RkSize                       m_mask   {0ULL};
+        RkSize                       m_cursor {0ULL};
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \brief Default constructor
+         * \param in_capacity Number of jobs in the ring, rounded up to the next power of 2
+         */
+        explicit JobPool(RkSize in_capacity) noexcept;
+
+        JobPool(JobPool const& in_copy) = delete;
+        JobPool(JobPool&&      in_move) = delete;
+        ~JobPool()                      = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Acquires a job from the pool
+         * \param in_job Job to move into the pooled job
+         * \param in_token Token to complete once the job is executed, if any
+         * \return Pooled job, must be released with Release() once executed or dropped
+         * \warning This must only be called by the owner of the pool
+         */
+        [[nodiscard]]
+        PooledJob* Acquire(Job&& in_job, CompletionToken* in_token = nullptr) noexcept;
+
+        /**
+         * \brief Destroys the callable of a pooled job and gives it back to its pool, this can be called from any thread
+         * \param in_job Job to release
+         * \warning The pool owning the job must still be alive
+         */
+        static RkVoid Release(PooledJob* in_job) noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        JobPool& operator=(JobPool const& in_copy) = delete;
+        JobPool& operator=(JobPool&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
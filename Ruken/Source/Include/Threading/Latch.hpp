@@ -0,0 +1,123 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Single use countdown latch, threads waiting on it sleep on a futex until the count reaches zero
+ *
+ * Unlike std::latch, waits can be bounded by a timeout.
+ * The thread counting the latch down to zero only touches the latch to wake the waiting threads up through its address,
+ * it is thus safe to destroy a latch as soon as a waiting thread has been released.
+ */
+class Latch
+{
+    private:
+
+        #pragma region Members
+
+        std::atomic<RkUint32> m_count;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        explicit Latch(RkUint32 in_count) noexcept;
+
+        Latch(Latch const& in_copy) = delete;
+        Latch(Latch&&      in_move) = delete;
+        ~Latch()                    = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Decrements the count of the latch, releasing every waiting thread if it reached zero
+         * \param in_count Value to decrement the count by, must not be greater than the current count
+         */
+        RkVoid CountDown(RkUint32 in_count = 1U) noexcept;
+
+        /**
+         * \brief Decrements the count of the latch, then blocks the calling thread until it reaches zero
+         * \param in_count Value to decrement the count by, must not be greater than the current count
+         */
+        RkVoid ArriveAndWait(RkUint32 in_count = 1U) noexcept;
+
+        /**
+         * \brief Returns the current count of the latch
+         * \return Current count
+         */
+        [[nodiscard]]
+        RkUint32 GetCount() const noexcept;
+
+        /**
+         * \brief Checks if the count reached zero, without blocking
+         * \return True if the count reached zero
+         */
+        [[nodiscard]]
+        RkBool TryWait() const noexcept;
+
+        /**
+         * \brief Blocks the calling thread until the count reaches zero
+         */
+        RkVoid Wait() const noexcept;
+
+        /**
+         * \brief Blocks the calling thread until the count reaches zero, or until the timeout expires
+         * \param in_timeout Maximum time to wait for
+         * \return True if the count reached zero, false if the timeout expired
+         */
+        [[nodiscard]]
+        RkBool WaitFor(std::chrono::nanoseconds in_timeout) const noexcept;
+
+        /**
+         * \brief Blocks the calling thread until the count reaches zero, or until the deadline is reached
+         * \param in_deadline Deadline, std::chrono::steady_clock::time_point::max() waits indefinitely
+         * \return True if the count reached zero, false if the deadline has been reached
+         */
+        [[nodiscard]]
+        RkBool WaitUntil(std::chrono::steady_clock::time_point in_deadline) const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        Latch& operator=(Latch const& in_copy) = delete;
+        Latch& operator=(Latch&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
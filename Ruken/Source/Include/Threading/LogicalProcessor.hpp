@@ -0,0 +1,65 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Describes a logical processor (hardware thread) of the machine
+ * \see CpuTopology
+ */
+struct LogicalProcessor
+{
+    /**
+     * \brief Processor group of the processor.
+     * \note  Only meaningful on Windows, where a group contains at most 64 logical processors
+     */
+    RkUint16 group {0U};
+
+    /**
+     * \brief Index of the processor in its group, or operating system index of the processor on other platforms
+     */
+    RkUint32 number {0U};
+
+    /**
+     * \brief Index of the physical core this processor belongs to, unique across the whole machine
+     */
+    RkUint32 core {0U};
+
+    /**
+     * \brief Index of the hardware thread in its core, 0 for the first one and 1+ for its SMT siblings
+     */
+    RkUint32 smt_index {0U};
+
+    /**
+     * \brief Index of the numa node this processor belongs to
+     */
+    RkUint32 numa_node {0U};
+};
+
+END_RUKEN_NAMESPACE
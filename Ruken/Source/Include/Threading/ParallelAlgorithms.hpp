@@ -0,0 +1,181 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <vector>
+#include <iterator>
+#include <concepts>
+#include <algorithm>
+#include <functional>
+
+#include "Build/Config.hpp"
+#include "Build/Namespace.hpp"
+#include "Threading/Scheduler.hpp"
+#include "Threading/CompletionToken.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief State shared by every job of a ParallelFor(), lives on the stack of the calling thread
+ * \tparam TFunction Function called on every sub-range
+ */
+template <typename TFunction>
+class ParallelForContext
+{
+    private:
+
+        #pragma region Members
+
+        TFunction&      m_function;
+        Scheduler&      m_scheduler;
+        RkSize const    m_grain_size;
+        RkBool const    m_deterministic;
+        CompletionToken m_split_jobs {};
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        ParallelForContext(TFunction& in_function, Scheduler& in_scheduler, RkSize in_grain_size) noexcept;
+
+        ParallelForContext(ParallelForContext const& in_copy) = delete;
+        ParallelForContext(ParallelForContext&&      in_move) = delete;
+        ~ParallelForContext()                                 = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Processes a range, splitting it for as long as other threads are looking for work.
+         *        In deterministic mode, the range is always split in halves down to the grain size.
+         * \param in_begin Beginning of the range
+         * \param in_end End of the range (excluded)
+         */
+        RkVoid Execute(RkSize in_begin, RkSize in_end) noexcept;
+
+        /**
+         * \brief Waits for every split job to be done, executing pending jobs in the meantime (see Scheduler::Wait())
+         */
+        RkVoid Wait() noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        ParallelForContext& operator=(ParallelForContext const& in_copy) = delete;
+        ParallelForContext& operator=(ParallelForContext&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+/**
+ * \brief Returns the number of chunks used by the algorithms splitting their work up front
+ * \note In deterministic mode, this does not depend on the number of workers (see RUKEN_PARALLEL_DETERMINISTIC_CHUNKS_COUNT)
+ * \param in_scheduler Scheduler executing the algorithm
+ * \param in_elements_count Number of elements to process
+ * \return Chunks count, between 1 and in_elements_count
+ */
+[[nodiscard]]
+RkSize GetParallelChunksCount(Scheduler const& in_scheduler, RkSize in_elements_count) noexcept;
+
+/**
+ * \brief Calls a function over sub-ranges of [in_begin, in_end) in parallel, the calling thread participates
+ *
+ * The range is split adaptively: a thread processing a range only splits off half of it into a new job
+ * if some other thread is looking for work (see Scheduler::HasStealDemand()). Otherwise it keeps processing
+ * the range grain by grain, and thus doesn't pay for the scheduling of jobs nobody would steal.
+ * In deterministic mode (see Scheduler::SetDeterministicMode()), the range is always split the same way,
+ * the sub-ranges passed to the function only depend on the range and on the grain size.
+ *
+ * \param in_scheduler Scheduler to use
+ * \param in_begin Beginning of the range
+ * \param in_end End of the range (excluded)
+ * \param in_function Function called as in_function(RkSize in_sub_begin, RkSize in_sub_end) from any thread
+ * \param in_grain_size Maximum size of the sub-ranges passed to the function, 0 picks one depending on the number of workers
+ */
+template <typename TFunction> requires std::invocable<TFunction&, RkSize, RkSize>
+RkVoid ParallelFor(Scheduler& in_scheduler, RkSize in_begin, RkSize in_end, TFunction&& in_function, RkSize in_grain_size = 0ULL) noexcept;
+
+/**
+ * \brief Reduces a range in parallel, the calling thread participates
+ *
+ * The range is cut into GetParallelChunksCount() chunks, each chunk is mapped to a partial result,
+ * and partial results are then combined pair by pair along a fixed binary tree, preserving their order.
+ * For a given number of chunks, the result is thus deterministic even for operations that are only associative
+ * (like floating point additions). In deterministic mode, the number of chunks does not depend on the number of workers
+ * either, and results are bit-identical across runs and machines.
+ *
+ * \param in_scheduler Scheduler to use
+ * \param in_begin Beginning of the range
+ * \param in_end End of the range (excluded)
+ * \param in_identity Identity element of the combine operation
+ * \param in_map Maps a sub-range to a partial result, called as in_map(RkSize in_sub_begin, RkSize in_sub_end)
+ * \param in_combine Associative operation combining 2 partial results
+ * \return Reduced value
+ */
+template <typename TValue, typename TMap, typename TCombine>
+    requires std::invocable<TMap&, RkSize, RkSize> && std::invocable<TCombine&, TValue, TValue>
+[[nodiscard]]
+TValue ParallelReduce(Scheduler& in_scheduler, RkSize in_begin, RkSize in_end, TValue in_identity, TMap&& in_map, TCombine&& in_combine) noexcept;
+
+/**
+ * \brief Computes the inclusive prefix scan of a range in parallel, the calling thread participates
+ *
+ * Chunks are first reduced in parallel, the chunk totals are then scanned sequentially,
+ * and every chunk is finally scanned in parallel starting from its offset.
+ * \note The output range can be the input range
+ *
+ * \param in_scheduler Scheduler to use
+ * \param in_first Beginning of the input range
+ * \param in_last End of the input range
+ * \param in_output Beginning of the output range
+ * \param in_identity Identity element of the combine operation
+ * \param in_combine Associative operation, std::plus<> for a prefix sum
+ */
+template <std::random_access_iterator TInput, std::random_access_iterator TOutput, typename TValue, typename TCombine = std::plus<>>
+RkVoid ParallelScan(Scheduler& in_scheduler, TInput in_first, TInput in_last, TOutput in_output, TValue in_identity, TCombine in_combine = {}) noexcept;
+
+/**
+ * \brief Sorts a range in parallel, the calling thread participates
+ *
+ * Chunks are sorted in parallel, and then merged pair by pair in parallel rounds, ping-ponging with a buffer.
+ * Small ranges (see RUKEN_PARALLEL_SORT_THRESHOLD) are sorted sequentially.
+ * \note The sort is not stable, and the elements must be default constructible
+ *
+ * \param in_scheduler Scheduler to use
+ * \param in_first Beginning of the range
+ * \param in_last End of the range
+ * \param in_compare Comparison function
+ */
+template <std::random_access_iterator TIterator, typename TCompare = std::less<>>
+RkVoid ParallelSort(Scheduler& in_scheduler, TIterator in_first, TIterator in_last, TCompare in_compare = {}) noexcept;
+
+#include "Threading/ParallelAlgorithms.inl"
+
+END_RUKEN_NAMESPACE
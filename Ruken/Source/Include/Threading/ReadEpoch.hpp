@@ -0,0 +1,125 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <limits>
+#include <atomic>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Epoch based reclamation, used to know when no reader can access a retired value anymore
+ *
+ * Every thread entering a read section announces the current global epoch in its own slot (one cache line per thread),
+ * so readers never write to a shared cache line.
+ * Writers retire a value by advancing the global epoch, the retired value can then be destroyed
+ * as soon as every active reader announced a more recent epoch.
+ *
+ * \note Read sections can be nested, only the outermost section of a thread is announced
+ */
+class ReadEpoch
+{
+    private:
+
+        struct alignas(64) Slot
+        {
+            std::atomic<RkUint64> epoch {std::numeric_limits<RkUint64>::max()};
+            std::atomic<RkBool>   owned {true};
+            Slot*                 next  {nullptr};
+        };
+
+        // Gives the slot of a thread back once the thread exits.
+        // Thread local instances are zero initialized, hence the missing initializer
+        struct SlotOwner
+        {
+            Slot* slot;
+
+            ~SlotOwner();
+        };
+
+        #pragma region Members
+
+        static constexpr RkUint64 idle_epoch = std::numeric_limits<RkUint64>::max();
+
+        // Slots are never destroyed, they are reused by new threads instead
+        inline static std::atomic<RkUint64> m_global_epoch {0ULL};
+        inline static std::atomic<Slot*>    m_slots        {nullptr};
+
+        inline static thread_local SlotOwner m_thread_slot;
+        inline static thread_local RkSize    m_thread_depth {0ULL};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the slot of the calling thread, acquiring one if needed
+         * \return Slot of the calling thread
+         */
+        static Slot& GetThreadSlot() noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        ReadEpoch() = delete;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Enters a read section, values retired from now on won't be reclaimed until the section is exited
+         */
+        static RkVoid Enter() noexcept;
+
+        /**
+         * \brief Exits the current read section
+         */
+        static RkVoid Exit() noexcept;
+
+        /**
+         * \brief Advances the global epoch, this must be called once a value has been unpublished
+         * \return Retirement epoch of the unpublished value
+         */
+        static RkUint64 Advance() noexcept;
+
+        /**
+         * \brief Checks if a retired value can be reclaimed
+         * \param in_epoch Retirement epoch of the value, as returned by Advance()
+         * \return True if no reader can access the value anymore
+         */
+        [[nodiscard]]
+        static RkBool IsReclaimable(RkUint64 in_epoch) noexcept;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,83 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <coroutine>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Threading/EJobPriority.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+class Scheduler;
+
+/**
+ * \brief Awaitable returned by Scheduler::Schedule()
+ *
+ * Awaiting it suspends the calling coroutine and resumes it on one of the workers of the scheduler.
+ * \note If the scheduler has been shutdown, the coroutine is never resumed
+ */
+class ScheduleAwaiter
+{
+    private:
+
+        #pragma region Members
+
+        Scheduler&   m_scheduler;
+        EJobPriority m_priority;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        ScheduleAwaiter(Scheduler& in_scheduler, EJobPriority in_priority) noexcept;
+
+        ScheduleAwaiter(ScheduleAwaiter const& in_copy) = default;
+        ScheduleAwaiter(ScheduleAwaiter&&      in_move) = default;
+        ~ScheduleAwaiter()                              = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        [[nodiscard]]
+        RkBool await_ready () const noexcept;
+        RkVoid await_suspend(std::coroutine_handle<> in_handle) const noexcept;
+        RkVoid await_resume () const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        ScheduleAwaiter& operator=(ScheduleAwaiter const& in_copy) = delete;
+        ScheduleAwaiter& operator=(ScheduleAwaiter&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
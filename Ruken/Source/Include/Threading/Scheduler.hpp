@@ -24,35 +24,134 @@
 
 #pragma once
 
+#include <array>
+#include <mutex>
+#include <limits>
 #include <atomic>
+#include <memory>
 #include <vector>
-#include <functional>
 
 #include "Core/Service.hpp"
 #include "Build/Namespace.hpp"
+#include "Threading/Job.hpp"
 #include "Threading/Worker.hpp"
+#include "Threading/JobPool.hpp"
+#include "Threading/CpuTopology.hpp"
+#include "Threading/EJobPriority.hpp"
+#include "Threading/WorkerCounters.hpp"
+#include "Threading/CompletionToken.hpp"
+#include "Threading/ScheduleAwaiter.hpp"
+#include "Threading/SchedulerParams.hpp"
 #include "Debug/Logging/Logger.hpp"
 #include "Types/FundamentalTypes.hpp"
-#include "Threading/ThreadSafeLockQueue.hpp"
+#include "Threading/WorkStealingDeque.hpp"
 
 BEGIN_RUKEN_NAMESPACE
 
 /**
  * \brief This class is responsible for the repartition of different tasks between workers
+ *
+ * Every worker owns a work stealing deque. Jobs scheduled from a worker are pushed onto its own deque,
+ * jobs scheduled from any other thread go through a global injection queue.
+ * Idle workers first look into their own deque, then into the injection queue, and finally
+ * try to steal jobs from the other workers, starting from a random one to spread the contention.
+ * Workers that found nothing to do spin for a short while, then yield a few times, and finally park
+ * until a new job is scheduled. Producers only wake a worker up if one of them is actually parked.
+ *
+ * Every priority class (see EJobPriority) has its own set of deques and its own injection queue.
+ * Workers always drain the critical jobs first, then the normal ones, and only then look for background jobs.
+ * At most a configurable number of workers execute background jobs at once, the other ones always stay
+ * available for frame critical work, even during a burst of resource loads.
+ *
+ * Workers can be pinned to their own logical processor (see SchedulerParams), in which case they are grouped per numa node.
+ * Workers steal from the workers of their own node first, and jobs scheduled for a given node
+ * are only executed by the workers of other nodes if nothing else is left to do.
  */
 class Scheduler final : public Service<Scheduler>
 {
-    public: using Job = std::function<RkVoid()>;
-
     private:
 
         #pragma region Members
 
-        std::vector<Worker>      m_workers;
-        std::atomic_bool         m_running;
-        ThreadSafeLockQueue<Job> m_job_queue;
+        // Identity of the calling thread, only set for the workers of a scheduler
+        inline static thread_local Scheduler const* m_current_scheduler    {nullptr};
+        inline static thread_local RkSize           m_current_worker_index {0ULL};
+        inline static thread_local RkUint32         m_random_state         {0U};
+        inline static thread_local RkBool           m_in_background_job    {false};
+        inline static thread_local RkSize           m_job_depth            {0ULL};
+
+        static constexpr RkSize priorities_count = 3ULL;
+
+        using JobQueue = WorkStealingDeque<PooledJob*>;
+
+        CpuTopology                           m_topology;
+        std::vector<Worker>                   m_workers;
+        std::vector<std::unique_ptr<JobPool>> m_pools;
+        std::atomic_bool                      m_running;
+
+        // Deques of the workers, indexed by priority and then by worker
+        std::array<std::vector<std::unique_ptr<JobQueue>>, priorities_count> m_queues;
+
+        // Numa node of every worker, and workers of every numa node.
+        // Without pinning, every worker is considered to be on the same node
+        RkSize                           m_numa_nodes_count   {1ULL};
+        std::vector<RkUint32>            m_workers_numa_node  {};
+        std::vector<std::vector<RkSize>> m_numa_nodes_workers {};
+
+        // Jobs scheduled from outside of the workers (or for another numa node), indexed by priority.
+        // The first queue of every priority is for jobs without any preference, followed by one queue per numa node.
+        // Producers are serialized by the injection mutex, and thus act as the owner of the injection queues.
+        // Workers only ever steal from these, this way, consuming injected jobs never takes a lock
+        std::mutex                                                           m_injection_mutex  {};
+        std::array<std::vector<std::unique_ptr<JobQueue>>, priorities_count> m_injection_queues {};
+        JobPool                                                              m_injection_pool;
+
+        // Jobs accounting of a thread, every worker owns its own on its own cache line,
+        // this way scheduling and executing jobs never contends with the other workers.
+        // Global counts are only computed by idle or waiting threads, by summing the accounting of every thread
+        struct alignas(64) JobsAccounting
+        {
+            std::array<std::atomic<RkUint64>, priorities_count> pushed_jobs    {};
+            std::array<std::atomic<RkUint64>, priorities_count> acquired_jobs  {};
+            std::atomic<RkUint64>                               completed_jobs {0ULL};
+        };
+
+        // Accounting of every worker, followed by the accounting shared by the threads outside of the scheduler
+        std::unique_ptr<JobsAccounting[]> m_accounting;
+
+        // Hint telling if some jobs of a given priority may be waiting to be picked up, checked by idle and stealing threads.
+        // Pushes only write it when it is not set yet, and it is only cleared once a thread found nothing to steal,
+        // the line thus stays shared between the workers while they are busy. See RefreshJobsHint()
+        struct alignas(64) JobsHint
+        {
+            std::array<std::atomic<RkBool>, priorities_count> may_have_jobs {};
+        };
+
+        JobsHint m_jobs_hint {};
+
+        // Threads waiting in WaitForQueuedTasks(), completed jobs only notify the completion epoch if there is any
+        std::atomic<RkUint32> m_completion_epoch     {0U};
+        std::atomic<RkSize>   m_queued_tasks_waiters {0ULL};
+
+        // Number of workers currently executing (or looking for) a background job
+        RkSize const        m_max_background_workers;
+        std::atomic<RkSize> m_background_workers_count {0ULL};
 
-        Logger* m_logger;
+        // Idle workers management, parked workers wait for the wake epoch to change
+        std::atomic<RkUint32> m_idle_spin_count;
+        std::atomic<RkUint32> m_idle_yield_count;
+        std::atomic<RkUint32> m_wake_epoch             {0U};
+        std::atomic<RkSize>   m_sleeping_workers_count {0ULL};
+
+        // Execution counters of every worker, followed by the counters shared by the threads outside of the scheduler
+        std::unique_ptr<WorkerCounters[]> m_counters;
+        std::atomic<RkUint64>             m_statistics_start;
+
+        // Deterministic mode, see SetDeterministicMode()
+        std::atomic<RkBool>   m_deterministic      {false};
+        std::atomic<RkUint64> m_deterministic_seed {0ULL};
+
+        Logger* m_logger {nullptr};
 
         #pragma endregion
 
@@ -60,8 +159,135 @@ class Scheduler final : public Service<Scheduler>
 
         /**
          * \brief Job given to every worker used my the scheduler
+         * \param in_worker_index Index of the worker
+         */
+        RkVoid WorkersJob(RkSize in_worker_index) noexcept;
+
+        /**
+         * \brief Looks for a job of a given priority, first in the deque of the worker,
+         *        then in the injection queue, and finally in the deques of the other workers
+         * \param in_worker_index Index of the worker looking for a job, any invalid index skips the local deque
+         * \param in_priority Priority of the job
+         * \return Acquired job or nullptr if no job could be found
+         */
+        PooledJob* AcquireJob(RkSize in_worker_index, EJobPriority in_priority) noexcept;
+
+        /**
+         * \brief Tries to steal a job from another worker, victims are iterated starting from a random one
+         *
+         * The workers of the same numa node are tried first, then the other workers,
+         * and finally the jobs scheduled for other numa nodes.
+         * \param in_worker_index Index of the thief, any invalid index steals from every worker alike
+         * \param in_priority Priority of the job
+         * \return Stolen job or nullptr if nothing could be stolen
+         */
+        PooledJob* StealJob(RkSize in_worker_index, EJobPriority in_priority) noexcept;
+
+        /**
+         * \brief Pushes a job in the queues of the given priority and wakes up a worker
+         * \param in_task Task to schedule
+         * \param in_token Token to complete once the job is executed, if any
+         * \param in_priority Priority of the task
+         * \param in_numa_node Numa node the job should preferably be executed on, invalid_numa_node for no preference
+         */
+        RkVoid PushJob(Job&& in_task, CompletionToken* in_token, EJobPriority in_priority, RkUint32 in_numa_node) noexcept;
+
+        /**
+         * \brief Executes a job, gives it back to its pool and completes its tokens
+         * \param in_job Job to execute
+         */
+        RkVoid ExecuteJob(PooledJob* in_job) noexcept;
+
+        /**
+         * \brief Gives back a job to its pool without executing it, its tokens are still completed
+         * \param in_job Job to drop
+         */
+        RkVoid DropJob(PooledJob* in_job) noexcept;
+
+        /**
+         * \brief Accounts a job as completed, waking up the threads waiting in WaitForQueuedTasks() if any
+         */
+        RkVoid CompleteJob() noexcept;
+
+        /**
+         * \brief Executes a job while waiting for something else, see Wait() and WaitForQueuedTasks()
+         * \return True if a job has been executed
+         */
+        RkBool TryExecuteWaitingJob() noexcept;
+
+        /**
+         * \brief Returns the execution counters of the calling thread
+         * \return Counters of the calling worker, or the counters shared by the threads outside of the scheduler
+         */
+        [[nodiscard]]
+        WorkerCounters& GetCurrentCounters() const noexcept;
+
+        /**
+         * \brief Returns the jobs accounting of the calling thread
+         * \return Accounting of the calling worker, or the accounting shared by the threads outside of the scheduler
+         */
+        [[nodiscard]]
+        JobsAccounting& GetCurrentAccounting() const noexcept;
+
+        /**
+         * \brief Returns the number of jobs of a given priority waiting to be picked up
+         *
+         * This sums the accounting of every thread, and is thus only used to refresh the jobs hint, see RefreshJobsHint().
+         * \param in_priority Priority of the jobs
+         * \return Pending jobs count, this might overestimate the jobs being acquired concurrently but never misses a pushed job
+         */
+        [[nodiscard]]
+        RkSize GetPendingJobsCount(EJobPriority in_priority) const noexcept;
+
+        /**
+         * \brief Checks the jobs hint of a given priority
+         * \param in_priority Priority of the jobs
+         * \return False if no job of this priority is waiting to be picked up, true if some might be
+         */
+        [[nodiscard]]
+        RkBool MayHaveJobs(EJobPriority in_priority) const noexcept;
+
+        /**
+         * \brief Clears the jobs hint of a given priority after a thread failed to find any job of this priority
+         *
+         * The hint is set again if the accounting still counts some pending jobs (a steal might have failed
+         * because of contention), in which case a parked worker is woken up to pick these up.
+         * \param in_priority Priority of the jobs
+         */
+        RkVoid RefreshJobsHint(EJobPriority in_priority) noexcept;
+
+        /**
+         * \brief Returns the number of jobs scheduled and not yet executed (or dropped)
+         * \return Unfinished jobs count, this might overestimate the jobs being completed concurrently but never misses a pushed job
+         */
+        [[nodiscard]]
+        RkSize GetUnfinishedJobsCount() const noexcept;
+
+        /**
+         * \brief Reserves one of the background slots, limiting the number of workers executing background jobs
+         * \return True if a slot has been reserved, false if every slot is already taken
+         */
+        RkBool AcquireBackgroundSlot() noexcept;
+
+        /**
+         * \brief Checks if a worker could find a job to execute, used to decide if a worker can go to sleep
+         * \return True if some jobs could be picked up
          */
-        RkVoid WorkersJob() noexcept;
+        [[nodiscard]]
+        RkBool HasAvailableJobs() const noexcept;
+
+        /**
+         * \brief Idles the calling worker until some jobs are available or the scheduler is shut down
+         *
+         * The worker spins first, then yields, and only parks once the whole spin budget has been consumed.
+         * \note This might return spuriously, the caller is expected to look for a job and call this again if needed
+         */
+        RkVoid WaitForJobs() noexcept;
+
+        /**
+         * \brief Wakes up a parked worker, if any
+         */
+        RkVoid WakeUpWorker() noexcept;
 
         #pragma endregion
 
@@ -72,6 +298,9 @@ class Scheduler final : public Service<Scheduler>
         // Static name of the service, used by the kernel to report service errors
         constexpr static const RkChar* service_name = RUKEN_STRING(Scheduler);
 
+        // Numa node of the threads that aren't pinned workers of the scheduler
+        constexpr static RkUint32 invalid_numa_node = std::numeric_limits<RkUint32>::max();
+
         #pragma endregion
 
         #pragma region Constructors
@@ -79,9 +308,18 @@ class Scheduler final : public Service<Scheduler>
         /**
          * \brief Scheduler constructor
          * \param in_service_provider Service provider
-         * \param in_workers_count Number of managed workers
+         * \param in_workers_count Number of managed workers, 0 spawns one worker per hardware thread, minus the calling thread
+         * \param in_max_background_workers Maximum number of workers executing background jobs at once,
+         *                                   0 uses RUKEN_SCHEDULER_MAX_BACKGROUND_WORKERS
+         */
+        Scheduler(ServiceProvider& in_service_provider, RkUint16 in_workers_count = 0U, RkUint16 in_max_background_workers = 0U) noexcept;
+
+        /**
+         * \brief Scheduler constructor
+         * \param in_service_provider Service provider
+         * \param in_params Parameters of the scheduler, including the placement of the workers
          */
-        Scheduler(ServiceProvider& in_service_provider, RkUint16 in_workers_count = 0U) noexcept;
+        Scheduler(ServiceProvider& in_service_provider, SchedulerParams const& in_params) noexcept;
 
         Scheduler(Scheduler const& in_copy) = delete;
         Scheduler(Scheduler&&      in_move) = delete;
@@ -94,22 +332,169 @@ class Scheduler final : public Service<Scheduler>
         /**
          * \brief Schedules a task on one of the available threads
          * \param in_task Task to schedule, any return value will be discarded
+         * \param in_priority Priority of the task
          * \note If Shutdown() has been called, this method has no effect
+         * \note The task is moved into a preallocated job, this doesn't allocate any memory
+         */
+        RkVoid ScheduleTask(Job&& in_task, EJobPriority in_priority = EJobPriority::Normal) noexcept;
+
+        /**
+         * \brief Schedules a task as a part of a group of jobs
+         * \param in_task Task to schedule, any return value will be discarded
+         * \param in_token Token of the group, completed once the task is executed. It must outlive the task
+         * \param in_priority Priority of the task
+         * \note If Shutdown() has been called, this method has no effect and the token is left untouched
          */
-        RkVoid ScheduleTask(Job&& in_task) noexcept;
+        RkVoid ScheduleTask(Job&& in_task, CompletionToken& in_token, EJobPriority in_priority = EJobPriority::Normal) noexcept;
 
         /**
-         * \brief Waits until all the queued tasks are completed
+         * \brief Schedules a task, preferably on the workers of a given numa node
+         *
+         * This is meant for jobs working on memory allocated on a specific numa node.
+         * The workers of other nodes only pick up these jobs if they have nothing else to do.
+         * \param in_task Task to schedule, any return value will be discarded
+         * \param in_numa_node Preferred numa node, see GetNumaNodesCount(). An invalid node means no preference
+         * \param in_priority Priority of the task
+         * \note Without pinned workers, this is the same as ScheduleTask()
+         */
+        RkVoid ScheduleTaskOnNode(Job&& in_task, RkUint32 in_numa_node, EJobPriority in_priority = EJobPriority::Normal) noexcept;
+
+        /**
+         * \brief Schedules a task as a part of a group of jobs, preferably on the workers of a given numa node
+         * \param in_task Task to schedule, any return value will be discarded
+         * \param in_numa_node Preferred numa node, see GetNumaNodesCount(). An invalid node means no preference
+         * \param in_token Token of the group, completed once the task is executed. It must outlive the task
+         * \param in_priority Priority of the task
+         */
+        RkVoid ScheduleTaskOnNode(Job&& in_task, RkUint32 in_numa_node, CompletionToken& in_token, EJobPriority in_priority = EJobPriority::Normal) noexcept;
+
+        /**
+         * \brief Waits for a group of jobs to be done, executing pending jobs on the calling thread in the meantime
+         *
+         * The calling thread only goes to sleep once there is nothing left to execute,
+         * ie. once the remaining jobs of the group are being executed by other threads.
+         * \param in_token Token of the group
+         */
+        RkVoid Wait(CompletionToken const& in_token) noexcept;
+
+        /**
+         * \brief Returns an awaitable used to move the calling coroutine onto a worker of the scheduler
+         * \param in_priority Priority of the job resuming the coroutine
+         * \return Awaitable, resuming the awaiting coroutine on a worker
+         * \see Task
+         */
+        [[nodiscard]]
+        ScheduleAwaiter Schedule(EJobPriority in_priority = EJobPriority::Normal) noexcept;
+
+        /**
+         * \brief Executes one pending job on the calling thread, if any
+         *
+         * This allows a thread waiting for some jobs to complete to participate instead of sleeping.
+         * Workers look into their own deque first, other threads start with the injection queue.
+         * \return True if a job has been executed, false if no job could be found
+         * \note Background jobs are never picked up here, a waiting thread would risk being stuck in a long job
+         */
+        RkBool TryExecuteJob() noexcept;
+
+        /**
+         * \brief Checks if splitting some work into more jobs would be useful right now
+         *
+         * This is the case if some workers are sleeping, or if every job the calling worker pushed has been stolen.
+         * \return True if there is some demand for more jobs
+         */
+        [[nodiscard]]
+        RkBool HasStealDemand() const noexcept;
+
+        /**
+         * \brief Waits until every scheduled task has been executed, including the tasks scheduled in the meantime
+         * \note The calling thread executes jobs while waiting, see Wait()
+         * \warning This must not be called from a job, the job would be waiting for itself
          */
         RkVoid WaitForQueuedTasks() noexcept;
 
         /**
-         * \brief Waits for all current active tasks to be done and drops any queued jobs. This also detaches any workers.
-         * \note This method can only be called once
+         * \brief Waits for all current active tasks to be done and drops any queued jobs. This also joins every worker.
+         * \note This method can only be called once, and never from a worker of the scheduler
          */
         RkVoid Shutdown() noexcept;
 
-        std::vector<Worker> const& GetWorkers() const noexcept;
+        /**
+         * \brief Sets the idle strategy of the workers
+         *
+         * Idle workers spin for a while, then yield their time slice a few times, and finally park until a job is scheduled.
+         * Larger budgets lower the wake up latency of the workers, at the cost of some power and of some cpu time
+         * taken away from the other processes.
+         * \param in_spin_count Number of spin iterations before yielding, 0 disables spinning
+         * \param in_yield_count Number of yields before parking, 0 disables yielding
+         */
+        RkVoid SetIdleSpinBudget(RkUint32 in_spin_count, RkUint32 in_yield_count) noexcept;
+
+        /**
+         * \brief Enables or disables the deterministic mode, meant to reproduce desyncs and order dependent bugs
+         *
+         * In deterministic mode, the users of the scheduler trade some throughput for reproducible executions:
+         * - Execution plans release their instructions to the workers in a topological order drawn from the seed (see ExecutionPlan)
+         * - Parallel algorithms split their work in a fixed number of chunks with a fixed split tree,
+         *   and reductions combine their partial results with a fixed tree shape (see ParallelAlgorithms)
+         * Data parallel work is still executed by every worker. Results are thus bit-identical across runs and workers counts,
+         * and running again with the same seed replays the same execution orders.
+         *
+         * \param in_enabled True to enable the deterministic mode
+         * \param in_seed Seed of the execution orders, changing it explores other valid orders
+         * \warning This must only be called from a synchronization point, when no plan or parallel algorithm is running
+         */
+        RkVoid SetDeterministicMode(RkBool in_enabled, RkUint64 in_seed = 0ULL) noexcept;
+
+        /**
+         * \return True if the scheduler is in deterministic mode
+         */
+        [[nodiscard]]
+        RkBool IsDeterministic() const noexcept;
+
+        /**
+         * \return Seed of the deterministic mode
+         */
+        [[nodiscard]]
+        RkUint64 GetDeterministicSeed() const noexcept;
+
+        /**
+         * \brief Aggregates the execution counters of every thread into statistics
+         *
+         * Counters are lock free and owned by each thread, this never blocks the workers.
+         * These statistics are meant to find out if the scheduler is saturated or starved,
+         * and to size the number of workers of a given machine.
+         * \return Statistics accumulated since the last reset
+         */
+        [[nodiscard]]
+        SchedulerStatistics GetStatistics() const noexcept;
+
+        /**
+         * \brief Sets every execution counter back to 0, and restarts the statistics period
+         */
+        RkVoid ResetStatistics() noexcept;
+
+        /**
+         * \brief Logs a summary of the statistics of the scheduler, along with the details of every worker
+         * \see RUKEN_SCHEDULER_STATISTICS_LOG_PERIOD
+         */
+        RkVoid LogStatisticsSummary() const noexcept;
+
+        /**
+         * \brief Returns the number of numa nodes the workers are spread on
+         * \return Numa nodes count, always 1 if the workers aren't pinned
+         */
+        [[nodiscard]]
+        RkSize GetNumaNodesCount() const noexcept;
+
+        /**
+         * \brief Returns the numa node of the calling thread
+         * \return Numa node of the calling worker, or invalid_numa_node if the calling thread isn't a worker of this scheduler
+         */
+        [[nodiscard]]
+        RkUint32 GetCurrentNumaNode() const noexcept;
+
+        [[nodiscard]] CpuTopology         const& GetTopology() const noexcept;
+        [[nodiscard]] std::vector<Worker> const& GetWorkers () const noexcept;
 
         #pragma endregion 
 
@@ -0,0 +1,79 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief This struct contains the parameters used when creating a scheduler
+ * \see Scheduler
+ */
+struct SchedulerParams
+{
+    /**
+     * \brief Number of managed workers.
+     * \note  0 spawns one worker per hardware thread (or per core if SMT siblings are skipped), minus the calling thread
+     */
+    RkUint16 workers_count {0U};
+
+    /**
+     * \brief Maximum number of workers executing background jobs at once.
+     * \note  0 uses RUKEN_SCHEDULER_MAX_BACKGROUND_WORKERS
+     */
+    RkUint16 max_background_workers {0U};
+
+    /**
+     * \brief Pins every worker to its own logical processor, workers are placed numa node by numa node.
+     *        Jobs scheduled for a given numa node (see Scheduler::ScheduleTaskOnNode) are then preferably
+     *        executed by the workers of that node.
+     * \note  The first processor is left to the calling thread whenever there are enough processors
+     */
+    RkBool pin_workers {false};
+
+    /**
+     * \brief Only places workers on the first hardware thread of every core, leaving the SMT siblings to the rest of the system
+     */
+    RkBool skip_smt_siblings {false};
+
+    /**
+     * \brief Names the worker threads, making them easier to find in debuggers and profilers
+     */
+    RkBool name_workers {true};
+
+    /**
+     * \brief Starts the scheduler in deterministic mode, see Scheduler::SetDeterministicMode()
+     */
+    RkBool deterministic {false};
+
+    /**
+     * \brief Seed of the deterministic mode, recording this seed is enough to replay the same execution orders
+     */
+    RkUint64 deterministic_seed {0ULL};
+};
+
+END_RUKEN_NAMESPACE
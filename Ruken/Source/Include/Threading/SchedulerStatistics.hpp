@@ -0,0 +1,78 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+// Number of buckets of the job latency histograms, the last bucket collects every latency above 2^30 nanoseconds (~1s)
+constexpr RkSize scheduler_latency_buckets_count = 32ULL;
+
+/**
+ * \brief Histogram of job latencies, bucket i counts the latencies in [2^(i-1), 2^i) nanoseconds.
+ *        Bucket 0 counts the latencies below 1 nanosecond.
+ */
+using LatencyHistogram = std::array<RkUint64, scheduler_latency_buckets_count>;
+
+/**
+ * \brief Execution statistics of a single thread of a scheduler
+ */
+struct WorkerStatistics
+{
+    RkUint64 jobs_executed       {0ULL}; // Number of jobs executed by the thread
+    RkUint64 busy_time           {0ULL}; // Nanoseconds spent executing jobs
+    RkUint64 idle_time           {0ULL}; // Nanoseconds spent spinning or parked while waiting for jobs
+    RkUint64 max_queue_depth     {0ULL}; // Highest number of jobs queued by the executing thread when starting a job
+    RkFloat  average_queue_depth {0.0F}; // Average number of jobs queued by the executing thread when starting a job
+    RkFloat  utilization         {0.0F}; // Ratio of busy time over the elapsed time, between 0 and 1
+};
+
+/**
+ * \brief Execution statistics of a scheduler, accumulated since the last reset
+ * \see Scheduler::GetStatistics, Scheduler::ResetStatistics
+ */
+struct SchedulerStatistics
+{
+    RkUint64 elapsed_time        {0ULL}; // Nanoseconds since the last reset
+    RkUint64 jobs_executed       {0ULL}; // Number of jobs executed by any thread
+    RkUint64 max_queue_depth     {0ULL}; // Highest number of jobs queued by the executing thread when starting a job
+    RkFloat  average_queue_depth {0.0F}; // Average number of jobs queued by the executing thread when starting a job
+    RkFloat  utilization         {0.0F}; // Average utilization of the workers, between 0 and 1
+    RkUint64 median_latency      {0ULL}; // Upper bound in nanoseconds of the median time between the scheduling and the start of a job
+    RkUint64 p99_latency         {0ULL}; // Upper bound in nanoseconds of the 99th percentile of that same time
+
+    LatencyHistogram latency_histogram {};
+
+    // Statistics of every worker, followed by the statistics of the threads outside of the scheduler
+    // that executed jobs while waiting (see Scheduler::Wait)
+    std::vector<WorkerStatistics> workers {};
+};
+
+END_RUKEN_NAMESPACE
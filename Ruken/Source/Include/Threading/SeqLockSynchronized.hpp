@@ -0,0 +1,246 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+#include "Build/Namespace.hpp"
+
+#include "Threading/CpuRelax.hpp"
+#include "Threading/EAccessMode.hpp"
+#include "Threading/Synchronized.hpp"
+#include "Threading/ESynchronizationPolicy.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+// Forward declaration
+template<class, EAccessMode>
+class SeqLockAccess;
+
+/**
+ * \brief Seqlock specialization of the Synchronized class
+ * \tparam TType Type of the synchronized value, must be trivially copyable
+ *
+ * Readers copy the value and check that no write happened during the copy, retrying otherwise.
+ * Reading never writes to the synchronized object, meaning that readers do not contend with each other at all.
+ * Writers are serialized and make readers retry, this is thus only suited to small values that are rarely written.
+ *
+ * \note Read accesses work on a snapshot of the value taken when the access is created
+ */
+template<typename TType>
+class Synchronized<TType, ESynchronizationPolicy::SeqLock>
+{
+    static_assert(std::is_trivially_copyable_v<TType>, "The seqlock policy only supports trivially copyable types");
+
+    template<class, EAccessMode> friend class SeqLockAccess;
+
+    public:
+
+        using ReadAccess     = SeqLockAccess<TType, EAccessMode::Read >;
+        using WriteAccess    = SeqLockAccess<TType, EAccessMode::Write>;
+        using UnderlyingType = TType;
+
+    private:
+
+        // The value is stored as atomic words, this way concurrent reads and writes are well defined
+        static constexpr RkSize words_count = (sizeof(TType) + sizeof(RkSize) - 1ULL) / sizeof(RkSize);
+
+        using Words = std::array<RkSize, words_count>;
+
+        #pragma region Variables
+
+        alignas(64) std::atomic<RkUint32>             m_sequence {0U};
+        std::array<std::atomic<RkSize>, words_count> m_words    {};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Copies the value, retrying until no write happened during the copy
+         * \param out_value Copied value
+         */
+        RkVoid Load(TType& out_value) const noexcept;
+
+        /**
+         * \brief Waits for any other writer and makes readers retry until EndWrite() is called
+         */
+        RkVoid BeginWrite() noexcept;
+
+        /**
+         * \brief Stores a new value and lets readers read it
+         * \param in_value New value
+         */
+        RkVoid EndWrite(TType const& in_value) noexcept;
+
+        /**
+         * \brief Stores a value without any synchronization
+         * \param in_value Value to store
+         */
+        RkVoid StoreWords(TType const& in_value) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \brief Constructs the content of the synchronized object using the following constructor: Type(Args...)
+         * \tparam TArgs Arguments type
+         * \param in_args arguments
+         */
+        template <typename ...TArgs, typename = std::enable_if_t<std::is_constructible_v<TType, TArgs...>>>
+        Synchronized(TArgs... in_args) noexcept;
+
+        Synchronized()                            noexcept;
+        Synchronized(Synchronized const& in_copy) = delete;
+        Synchronized(Synchronized&&      in_move) = delete;
+        ~Synchronized()                           = default;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        Synchronized& operator=(Synchronized const& in_copy) = delete;
+        Synchronized& operator=(Synchronized&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+/**
+ * \brief Allows safe accesses to a seqlock Synchronized object using the RAII principle
+ * \brief Read access specialization, the value is copied once on construction
+ *
+ * \tparam TData Synchronized object's type
+ */
+template<class TData, EAccessMode TMode>
+class SeqLockAccess
+{
+    static_assert(TMode == EAccessMode::Read, "The seqlock policy only supports read and write accesses");
+
+    private:
+
+        #pragma region Members
+
+        TData m_value;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        SeqLockAccess(Synchronized<TData, ESynchronizationPolicy::SeqLock> const& in_synchronized) noexcept;
+
+        SeqLockAccess(SeqLockAccess const& in_copy) = delete;
+        SeqLockAccess(SeqLockAccess&&      in_move) = delete;
+        ~SeqLockAccess()                            = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Synchronized getter
+         * \return Snapshot of the synchronized object's content
+         */
+        [[nodiscard]]
+        TData const& Get() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        SeqLockAccess& operator=(SeqLockAccess const& in_copy) = delete;
+        SeqLockAccess& operator=(SeqLockAccess&&      in_move) = delete;
+
+        [[nodiscard]] TData const& operator* () const noexcept;
+        [[nodiscard]] TData const* operator->() const noexcept;
+
+        #pragma endregion
+};
+
+/**
+ * \brief Allows safe accesses to a seqlock Synchronized object using the RAII principle
+ * \brief Write access specialization, modifications are published when the access is destroyed
+ *
+ * \tparam TData Synchronized object's type
+ */
+template<class TData>
+class SeqLockAccess<TData, EAccessMode::Write>
+{
+    private:
+
+        #pragma region Members
+
+        Synchronized<TData, ESynchronizationPolicy::SeqLock>& m_synchronized;
+        TData                                                 m_value;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        SeqLockAccess(Synchronized<TData, ESynchronizationPolicy::SeqLock>& in_synchronized) noexcept;
+
+        SeqLockAccess(SeqLockAccess const& in_copy) = delete;
+        SeqLockAccess(SeqLockAccess&&      in_move) = delete;
+        ~SeqLockAccess() noexcept;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Synchronized getters
+         * \return Synchronized's object content
+         */
+        [[nodiscard]] TData&       Get()       noexcept;
+        [[nodiscard]] TData const& Get() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        SeqLockAccess& operator=(SeqLockAccess const& in_copy) = delete;
+        SeqLockAccess& operator=(SeqLockAccess&&      in_move) = delete;
+
+        [[nodiscard]] TData&       operator* ()       noexcept;
+        [[nodiscard]] TData const& operator* () const noexcept;
+
+        [[nodiscard]] TData*       operator->()       noexcept;
+        [[nodiscard]] TData const* operator->() const noexcept;
+
+        #pragma endregion
+};
+
+#include "Threading/SeqLockSynchronized.inl"
+
+END_RUKEN_NAMESPACE
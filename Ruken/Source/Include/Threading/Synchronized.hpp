@@ -29,6 +29,7 @@
 #include "Build/Namespace.hpp"
 
 #include "Threading/EAccessMode.hpp"
+#include "Threading/ESynchronizationPolicy.hpp"
 
 BEGIN_RUKEN_NAMESPACE
 
@@ -53,9 +54,13 @@ class SynchronizedAccess;
  * Simple and easy to use
  *    - Simply replace your mutex by Synchronized objects and locks by SynchronizedAccess objects.
  * 
+ * The synchronization policy can be changed with the second template argument (see ESynchronizationPolicy).
+ * Every policy exposes the same ReadAccess and WriteAccess types, switching policy thus only requires to change the declaration.
+ * This primary template implements the SharedMutex policy.
+ *
  * TODO: Synchronized move and copy operators/constructors
  */
-template<typename TType>
+template<typename TType, ESynchronizationPolicy TPolicy = ESynchronizationPolicy::SharedMutex>
 class Synchronized
 {
     // Allows the exclusive access to m_mutex
@@ -118,4 +123,7 @@ class Synchronized
 
 #include "Threading/Synchronized.inl"
 
-END_RUKEN_NAMESPACE
\ No newline at end of file
+END_RUKEN_NAMESPACE
+
+#include "Threading/SeqLockSynchronized.hpp"
+#include "Threading/CopyOnWriteSynchronized.hpp"
\ No newline at end of file
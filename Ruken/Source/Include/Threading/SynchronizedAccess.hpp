@@ -28,12 +28,10 @@
 
 #include "Build/Namespace.hpp"
 #include "Threading/EAccessMode.hpp"
+#include "Threading/Synchronized.hpp"
 
 BEGIN_RUKEN_NAMESPACE
 
-template <typename TType>
-class Synchronized;
-
 /**
  * \brief Allows safe accesses to a Synchronized object using the RAII principle
  * 
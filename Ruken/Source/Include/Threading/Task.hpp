@@ -0,0 +1,329 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <atomic>
+#include <utility>
+#include <concepts>
+#include <optional>
+#include <coroutine>
+#include <exception>
+
+#include "Build/Namespace.hpp"
+#include "Meta/Assert.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+template <typename TResult>
+class Task;
+
+/**
+ * \brief Counts the tasks of a WhenAll() that are still running, the last one to complete resumes the awaiting coroutine
+ */
+struct TaskJoinCounter
+{
+    std::atomic<RkSize>     remaining    {0ULL};
+    std::coroutine_handle<> continuation {};
+
+    /**
+     * \brief Marks one of the joined tasks as done
+     * \return Awaiting coroutine if this was the last task, std::noop_coroutine() otherwise
+     */
+    [[nodiscard]]
+    std::coroutine_handle<> Arrive() noexcept;
+};
+
+/**
+ * \brief Part of the promise of a task that doesn't depend on the result type
+ */
+class TaskPromiseBase
+{
+    private:
+
+        /**
+         * \brief Awaited at the end of the coroutine, transfers the execution to whatever is waiting for the task
+         */
+        struct FinalAwaiter
+        {
+            [[nodiscard]]
+            RkBool                  await_ready  () const noexcept;
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> in_handle) const noexcept;
+            RkVoid                  await_resume () const noexcept;
+
+            TaskPromiseBase& promise;
+        };
+
+    protected:
+
+        #pragma region Members
+
+        // Only one of these is set, depending on how the task has been started
+        std::coroutine_handle<> m_continuation {};
+        TaskJoinCounter*        m_join_counter {nullptr};
+        RkBool                  m_detached     {false};
+
+        std::exception_ptr m_exception {};
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Methods
+
+        [[nodiscard]] std::suspend_always initial_suspend    () const noexcept;
+        [[nodiscard]] FinalAwaiter        final_suspend      ()       noexcept;
+                      RkVoid              unhandled_exception()       noexcept;
+
+        RkVoid SetContinuation(std::coroutine_handle<> in_continuation) noexcept;
+        RkVoid SetJoinCounter (TaskJoinCounter*        in_join_counter) noexcept;
+        RkVoid SetDetached    ()                                        noexcept;
+
+        /**
+         * \brief Rethrows the exception that escaped the coroutine, if any
+         */
+        RkVoid RethrowException() const;
+
+        #pragma endregion
+};
+
+template <typename TResult>
+class TaskPromise final : public TaskPromiseBase
+{
+    private:
+
+        #pragma region Members
+
+        std::optional<TResult> m_result {};
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Methods
+
+        [[nodiscard]]
+        Task<TResult> get_return_object() noexcept;
+
+        template <typename TValue> requires std::convertible_to<TValue&&, TResult>
+        RkVoid return_value(TValue&& in_value) noexcept(std::is_nothrow_constructible_v<TResult, TValue&&>);
+
+        [[nodiscard]]
+        TResult TakeResult();
+
+        #pragma endregion
+};
+
+template <>
+class TaskPromise<RkVoid> final : public TaskPromiseBase
+{
+    public:
+
+        #pragma region Methods
+
+        [[nodiscard]]
+        Task<RkVoid> get_return_object() noexcept;
+
+        RkVoid return_void() const noexcept;
+        RkVoid TakeResult () const;
+
+        #pragma endregion
+};
+
+/**
+ * \brief Lazily started coroutine, producing a value of type TResult
+ *
+ * A task only starts once awaited (co_await task), detached (task.Detach()) or joined (co_await WhenAll(...)).
+ * Awaiting a task suspends the awaiting coroutine until the task completes, without ever blocking the thread:
+ * the awaiting coroutine is directly resumed by the thread completing the task.
+ * Awaiting a task that already completed returns its result right away.
+ *
+ * \code
+ * Task<RkVoid> LoadLevel(Scheduler& in_scheduler, Handle<Texture> in_texture)
+ * {
+ *     // Moving the execution to a worker
+ *     co_await in_scheduler.Schedule();
+ *
+ *     // Suspending until the texture is loaded, without blocking the worker
+ *     if (!co_await in_texture)
+ *         co_return;
+ *
+ *     ...
+ * }
+ * \endcode
+ *
+ * \tparam TResult Result type of the task
+ */
+template <typename TResult = RkVoid>
+class Task
+{
+    public:
+
+        using promise_type = TaskPromise<TResult>;
+
+    private:
+
+        /**
+         * \brief Awaiter used by co_await task, starts the task and resumes the awaiting coroutine once it's done
+         */
+        struct Awaiter
+        {
+            [[nodiscard]]
+            RkBool                  await_ready  () const noexcept;
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> in_awaiting) const noexcept;
+            TResult                 await_resume () const;
+
+            std::coroutine_handle<promise_type> handle;
+        };
+
+        #pragma region Members
+
+        std::coroutine_handle<promise_type> m_handle {};
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        Task() = default;
+        explicit Task(std::coroutine_handle<promise_type> in_handle) noexcept;
+
+        Task(Task const& in_copy) = delete;
+        Task(Task&&      in_move) noexcept;
+        ~Task();
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Starts the task, the task then owns itself and is destroyed as soon as it completes
+         * \note An exception escaping a detached task terminates the program
+         */
+        RkVoid Detach() noexcept;
+
+        /**
+         * \brief Starts the task as a part of a WhenAll(), or just signals the counter if the task is already done
+         * \param in_join_counter Counter to signal once the task is done
+         */
+        RkVoid Join(TaskJoinCounter& in_join_counter) noexcept;
+
+        /**
+         * \brief Checks if the task is done
+         * \return True if the task completed, false if it is still running or hasn't been started
+         */
+        [[nodiscard]]
+        RkBool Done() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        Task& operator=(Task const& in_copy) = delete;
+        Task& operator=(Task&&      in_move) noexcept;
+
+        /**
+         * \brief Starts the task and awaits its result
+         * \note Awaiting an empty task, either default constructed or moved from, asserts
+         */
+        [[nodiscard]]
+        Awaiter operator co_await() const noexcept;
+
+        #pragma endregion
+};
+
+/**
+ * \brief Awaitable returned by WhenAll(), starts every task and resumes the awaiting coroutine once all of them are done
+ * \tparam TTasks Container of the tasks to join, either a tuple of task references or a vector of tasks
+ */
+template <typename TTasks>
+class WhenAllAwaiter
+{
+    private:
+
+        #pragma region Members
+
+        TTasks          m_tasks;
+        TaskJoinCounter m_join_counter {};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        template <typename TCallback>
+        RkVoid ForEachTask(TCallback&& in_callback) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        explicit WhenAllAwaiter(TTasks in_tasks) noexcept;
+
+        WhenAllAwaiter(WhenAllAwaiter const& in_copy) = delete;
+        WhenAllAwaiter(WhenAllAwaiter&&      in_move) = delete;
+        ~WhenAllAwaiter()                             = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        [[nodiscard]]
+        RkBool await_ready  () const noexcept;
+        RkBool await_suspend(std::coroutine_handle<> in_awaiting) noexcept;
+        RkVoid await_resume () const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        WhenAllAwaiter& operator=(WhenAllAwaiter const& in_copy) = delete;
+        WhenAllAwaiter& operator=(WhenAllAwaiter&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+/**
+ * \brief Runs multiple tasks concurrently and waits for all of them to complete
+ *
+ * The results are kept by the tasks themselves, awaiting a task once joined returns its result without suspending.
+ * \param in_tasks Tasks to join, these must not have been started yet
+ * \return Awaitable
+ */
+template <typename... TResults>
+[[nodiscard]]
+WhenAllAwaiter<std::tuple<Task<TResults>&...>> WhenAll(Task<TResults>&... in_tasks) noexcept;
+
+template <typename TResult>
+[[nodiscard]]
+WhenAllAwaiter<std::vector<Task<TResult>>&> WhenAll(std::vector<Task<TResult>>& in_tasks) noexcept;
+
+#include "Threading/Task.inl"
+
+END_RUKEN_NAMESPACE
@@ -0,0 +1,135 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <iostream>
+
+#include "Utility/Benchmark.hpp"
+#include "Threading/Scheduler.hpp"
+#include "Core/ServiceProvider.hpp"
+#include "Threading/ExecutionPlan.hpp"
+#include "Threading/ParallelAlgorithms.hpp"
+
+USING_RUKEN_NAMESPACE
+
+/**
+ * \brief Measures the cost of the deterministic mode of the scheduler against the normal mode, from 1 to 32 workers.
+ *
+ * Every run executes a floating point reduction, a parallel for, and an execution plan made of packs of independent
+ * instructions (each instruction running a small parallel for, like a system would), first in normal mode and then in deterministic mode.
+ * The deterministic reductions are also checked to be bit-identical across every workers count.
+ *
+ * \param in_service_provider Service provider used to create the benchmarked schedulers
+ * \param in_elements_count Number of elements processed by the parallel algorithms
+ * \param in_executions_count Number of executions of every benchmark
+ */
+inline RkVoid DeterministicModeBenchmark(ServiceProvider& in_service_provider,
+                                         RkSize const     in_elements_count   = 1ULL << 22ULL,
+                                         RkSize const     in_executions_count = 64ULL) noexcept
+{
+    std::vector<RkFloat> source (in_elements_count);
+    std::vector<RkFloat> results(in_elements_count);
+
+    // Values of very different magnitudes, making the floating point sum sensitive to the order of the additions
+    for (RkSize index = 0ULL; index < in_elements_count; ++index)
+        source[index] = std::ldexp(static_cast<RkFloat>(index % 97ULL) + 0.1F, static_cast<RkInt>(index % 23ULL) - 11);
+
+    RkBool   reference_set = false;
+    RkDouble reference_sum = 0.0;
+
+    for (RkUint16 workers_count = 1U; workers_count <= 32U; workers_count *= 2U)
+    {
+        Scheduler     scheduler(in_service_provider, workers_count);
+        ExecutionPlan plan;
+
+        // 8 packs of 8 instructions
+        for (RkSize pack = 0ULL; pack < 8ULL; ++pack)
+        {
+            for (RkSize instruction = 0ULL; instruction < 8ULL; ++instruction)
+            {
+                plan.AddInstruction([&, instruction] {
+                    RkSize const slice = in_elements_count / 8ULL;
+
+                    ParallelFor(scheduler, slice * instruction, slice * (instruction + 1ULL), [&](RkSize const in_begin, RkSize const in_end) {
+                        for (RkSize index = in_begin; index < in_end; ++index)
+                            results[index] = results[index] * 0.5F + source[index];
+                    });
+                });
+            }
+
+            plan.EndInstructionPack();
+        }
+
+        for (RkBool const deterministic: {false, true})
+        {
+            scheduler.SetDeterministicMode(deterministic, 42ULL);
+
+            std::string const suffix = std::string(deterministic ? " (deterministic)" : " (normal)") + " - " + std::to_string(workers_count) + " workers";
+
+            std::string const reduce_label = "ParallelReduce" + suffix;
+            std::string const for_label    = "ParallelFor"    + suffix;
+            std::string const plan_label   = "ExecutionPlan"  + suffix;
+
+            RkDouble sum = 0.0;
+            LOOPED_BENCHMARK(reduce_label, in_executions_count)
+            {
+                sum = ParallelReduce(scheduler, 0ULL, in_elements_count, 0.0, [&](RkSize const in_begin, RkSize const in_end) {
+                    RkDouble partial = 0.0;
+                    for (RkSize index = in_begin; index < in_end; ++index)
+                        partial += source[index];
+
+                    return partial;
+                }, std::plus<>());
+            }
+
+            LOOPED_BENCHMARK(for_label, in_executions_count)
+            {
+                ParallelFor(scheduler, 0ULL, in_elements_count, [&](RkSize const in_begin, RkSize const in_end) {
+                    for (RkSize index = in_begin; index < in_end; ++index)
+                        results[index] = std::sqrt(source[index]);
+                });
+            }
+
+            LOOPED_BENCHMARK(plan_label, in_executions_count)
+                plan.ExecutePlanAsynchronously(scheduler);
+
+            if (!deterministic)
+                continue;
+
+            if (!reference_set)
+            {
+                reference_sum = sum;
+                reference_set = true;
+            }
+
+            else if (std::memcmp(&reference_sum, &sum, sizeof(RkDouble)) != 0)
+                std::cout << "Deterministic reduction differs with " << workers_count << " workers" << std::endl;
+        }
+    }
+}
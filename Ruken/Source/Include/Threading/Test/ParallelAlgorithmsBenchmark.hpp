@@ -0,0 +1,105 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "Utility/Benchmark.hpp"
+#include "Threading/Scheduler.hpp"
+#include "Core/ServiceProvider.hpp"
+#include "Threading/ParallelAlgorithms.hpp"
+
+USING_RUKEN_NAMESPACE
+
+/**
+ * \brief Measures the scaling of the parallel algorithms from 1 to 32 workers.
+ *
+ * Every algorithm is run on the same data set for every workers count,
+ * the sequential standard library equivalent is measured once as a baseline.
+ *
+ * \param in_service_provider Service provider used to create the benchmarked schedulers
+ * \param in_elements_count Number of elements processed by every algorithm
+ */
+inline RkVoid ParallelAlgorithmsBenchmark(ServiceProvider& in_service_provider, RkSize const in_elements_count = 1ULL << 22ULL) noexcept
+{
+    std::vector<RkUint32> source(in_elements_count);
+    std::vector<RkUint32> values(in_elements_count);
+    std::vector<RkFloat>  floats(in_elements_count);
+
+    std::mt19937 generator(42U);
+    std::generate(source.begin(), source.end(), generator);
+
+    std::string const baseline_label = "std::sort baseline - " + std::to_string(in_elements_count) + " elements";
+
+    values = source;
+    BENCHMARK(baseline_label)
+        std::sort(values.begin(), values.end());
+
+    for (RkUint16 workers_count = 1U; workers_count <= 32U; workers_count *= 2U)
+    {
+        Scheduler         scheduler(in_service_provider, workers_count);
+        std::string const suffix = " - " + std::to_string(workers_count) + " workers, " + std::to_string(in_elements_count) + " elements";
+
+        std::string const for_label    = "ParallelFor"    + suffix;
+        std::string const reduce_label = "ParallelReduce" + suffix;
+        std::string const scan_label   = "ParallelScan"   + suffix;
+        std::string const sort_label   = "ParallelSort"   + suffix;
+
+        BENCHMARK(for_label)
+        {
+            ParallelFor(scheduler, 0ULL, in_elements_count, [&](RkSize const in_begin, RkSize const in_end) {
+                for (RkSize index = in_begin; index < in_end; ++index)
+                    floats[index] = std::sqrt(static_cast<RkFloat>(source[index]));
+            });
+        }
+
+        RkUint64 sum = 0ULL;
+        BENCHMARK(reduce_label)
+        {
+            sum = ParallelReduce(scheduler, 0ULL, in_elements_count, 0ULL, [&](RkSize const in_begin, RkSize const in_end) {
+                RkUint64 partial = 0ULL;
+                for (RkSize index = in_begin; index < in_end; ++index)
+                    partial += source[index];
+
+                return partial;
+            }, std::plus<>());
+        }
+
+        BENCHMARK(scan_label)
+            ParallelScan(scheduler, source.begin(), source.end(), values.begin(), 0U);
+
+        values = source;
+        BENCHMARK(sort_label)
+            ParallelSort(scheduler, values.begin(), values.end());
+
+        // Keeps the reduction from being optimized away
+        if (sum == 0ULL || !std::is_sorted(values.begin(), values.end()))
+            return;
+    }
+}
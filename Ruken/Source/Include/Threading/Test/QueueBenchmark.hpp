@@ -0,0 +1,159 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "Utility/Benchmark.hpp"
+#include "Threading/BlockingQueue.hpp"
+#include "Threading/BoundedMpmcQueue.hpp"
+#include "Threading/BoundedSpscQueue.hpp"
+#include "Threading/ThreadSafeLockQueue.hpp"
+
+USING_RUKEN_NAMESPACE
+
+/**
+ * \brief Measures the throughput of the queues under contention, from 1 to 8 producers and as many consumers.
+ *
+ * Every producer enqueues the same number of items and every consumer dequeues the same number of items,
+ * the lock based ThreadSafeLockQueue is measured as a baseline against the blocking lock-free queues.
+ * The single producer single consumer queue is measured once, with one producer and one consumer.
+ *
+ * \param in_items_count Number of items transferred per run
+ * \param in_capacity Capacity of the bounded queues
+ */
+inline RkVoid QueueContentionBenchmark(RkSize const in_items_count = 1ULL << 20ULL, RkSize const in_capacity = 1024ULL) noexcept
+{
+    // Runs the producers and the consumers on their own threads, the calling thread only waits for them
+    auto const run = [](RkSize const in_threads_count, RkSize const in_items_per_thread, auto const& in_produce, auto const& in_consume) {
+        std::vector<std::thread> threads;
+        threads.reserve(in_threads_count * 2ULL);
+
+        for (RkSize index = 0ULL; index < in_threads_count; ++index)
+        {
+            threads.emplace_back([&] { in_produce(in_items_per_thread); });
+            threads.emplace_back([&] { in_consume(in_items_per_thread); });
+        }
+
+        for (std::thread& thread: threads)
+            thread.join();
+    };
+
+    for (RkSize threads_count = 1ULL; threads_count <= 8ULL; threads_count *= 2ULL)
+    {
+        RkSize      const items_per_thread = in_items_count / threads_count;
+        std::string const suffix           = " - " + std::to_string(threads_count) + " producers/consumers, " + std::to_string(items_per_thread * threads_count) + " items";
+
+        std::string const lock_label = "ThreadSafeLockQueue" + suffix;
+        std::string const mpmc_label = "BlockingQueue<BoundedMpmcQueue>" + suffix;
+
+        {
+            ThreadSafeLockQueue<RkSize> queue;
+
+            BENCHMARK(lock_label)
+            {
+                run(threads_count, items_per_thread, [&](RkSize const in_count) {
+                    for (RkSize index = 0ULL; index < in_count; ++index)
+                        queue.Enqueue(RkSize {index});
+                }, [&](RkSize const in_count) {
+                    RkSize item;
+                    for (RkSize index = 0ULL; index < in_count; ++index)
+                        (RkVoid)queue.Dequeue(item);
+                });
+            }
+        }
+
+        {
+            BlockingQueue<BoundedMpmcQueue, RkSize> queue(in_capacity);
+
+            BENCHMARK(mpmc_label)
+            {
+                run(threads_count, items_per_thread, [&](RkSize const in_count) {
+                    for (RkSize index = 0ULL; index < in_count; ++index)
+                        (RkVoid)queue.Enqueue(RkSize {index});
+                }, [&](RkSize const in_count) {
+                    RkSize item;
+                    for (RkSize index = 0ULL; index < in_count; ++index)
+                        (RkVoid)queue.Dequeue(item);
+                });
+            }
+        }
+    }
+
+    std::string const spsc_label  = "BlockingQueue<BoundedSpscQueue> - 1 producer/consumer, "          + std::to_string(in_items_count) + " items";
+    std::string const batch_label = "BlockingQueue<BoundedSpscQueue> - 1 producer/consumer, batches, " + std::to_string(in_items_count) + " items";
+
+    {
+        BlockingQueue<BoundedSpscQueue, RkSize> queue(in_capacity);
+
+        BENCHMARK(spsc_label)
+        {
+            run(1ULL, in_items_count, [&](RkSize const in_count) {
+                for (RkSize index = 0ULL; index < in_count; ++index)
+                    (RkVoid)queue.Enqueue(RkSize {index});
+            }, [&](RkSize const in_count) {
+                RkSize item;
+                for (RkSize index = 0ULL; index < in_count; ++index)
+                    (RkVoid)queue.Dequeue(item);
+            });
+        }
+    }
+
+    {
+        BoundedSpscQueue<RkSize> queue(in_capacity);
+
+        BENCHMARK(batch_label)
+        {
+            run(1ULL, in_items_count, [&](RkSize const in_count) {
+                RkSize items[64];
+                for (RkSize index = 0ULL; index < in_count;)
+                {
+                    RkSize const count = std::min<RkSize>(64ULL, in_count - index);
+                    for (RkSize item = 0ULL; item < count; ++item)
+                        items[item] = index + item;
+
+                    RkSize const enqueued = queue.TryEnqueueBatch(items, count);
+                    if (enqueued == 0ULL)
+                        std::this_thread::yield();
+
+                    index += enqueued;
+                }
+            }, [&](RkSize const in_count) {
+                RkSize items[64];
+                for (RkSize index = 0ULL; index < in_count;)
+                {
+                    RkSize const dequeued = queue.TryDequeueBatch(items, std::min<RkSize>(64ULL, in_count - index));
+                    if (dequeued == 0ULL)
+                        std::this_thread::yield();
+
+                    index += dequeued;
+                }
+            });
+        }
+    }
+}
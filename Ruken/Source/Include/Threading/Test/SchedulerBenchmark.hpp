@@ -0,0 +1,68 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "Utility/Benchmark.hpp"
+#include "Threading/Scheduler.hpp"
+#include "Threading/CompletionToken.hpp"
+#include "Core/ServiceProvider.hpp"
+
+USING_RUKEN_NAMESPACE
+
+/**
+ * \brief Measures the job throughput of the scheduler from 1 to 32 workers.
+ *
+ * Half of the jobs are scheduled from the calling thread, going through the injection queue,
+ * and each of these jobs schedules a child job from its worker, exercising the work stealing deques.
+ *
+ * \param in_service_provider Service provider used to create the benchmarked schedulers
+ * \param in_jobs_count Number of jobs executed per run
+ */
+inline RkVoid SchedulerThroughputBenchmark(ServiceProvider& in_service_provider, RkSize const in_jobs_count = 50000ULL) noexcept
+{
+    for (RkUint16 workers_count = 1U; workers_count <= 32U; workers_count *= 2U)
+    {
+        Scheduler       scheduler(in_service_provider, workers_count);
+        CompletionToken token     {};
+        RkSize const    root_jobs {in_jobs_count / 2ULL};
+
+        std::string const label = "Scheduler throughput - " + std::to_string(workers_count) + " workers, " + std::to_string(root_jobs * 2ULL) + " jobs";
+
+        BENCHMARK(label)
+        {
+            for (RkSize index = 0ULL; index < root_jobs; ++index)
+            {
+                scheduler.ScheduleTask([&scheduler, &token] {
+                    scheduler.ScheduleTask([] {}, token);
+                }, token);
+            }
+
+            // The calling thread executes jobs as well until every job is done
+            scheduler.Wait(token);
+        }
+    }
+}
@@ -29,6 +29,7 @@
 #include <mutex>
 #include <queue>
 #include <atomic>
+#include <condition_variable>
 
 #include "Types/FundamentalTypes.hpp"
 #include "Threading/Synchronized.hpp"
@@ -24,11 +24,13 @@
 
 #pragma once
 
+#include <deque>
+
 #include "Build/Namespace.hpp"
 
-#include "Containers/Queue.hpp"
 #include "Threading/Synchronized.hpp"
 #include "Types/FundamentalTypes.hpp"
+#include "Threading/SynchronizedAccess.hpp"
 
 BEGIN_RUKEN_NAMESPACE
 
@@ -43,10 +45,10 @@ class ThreadSafeQueue
 
         #pragma region Members
 
-        Synchronized<Queue<TType>> m_queue;
+        mutable Synchronized<std::deque<TType>> m_queue;
 
-        using QueueReadAccess  = decltype(m_queue)::ReadAccess;
-        using QueueWriteAccess = decltype(m_queue)::WriteAccess;
+        using QueueReadAccess  = typename decltype(m_queue)::ReadAccess;
+        using QueueWriteAccess = typename decltype(m_queue)::WriteAccess;
 
         #pragma endregion
 
@@ -0,0 +1,156 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <type_traits>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Chase-Lev work stealing deque.
+ *
+ * The owner thread pushes and pops items at the bottom of the deque (LIFO, which keeps the caches warm)
+ * while any other thread can steal items from the top of it (FIFO, oldest items first).
+ * Push and Pop are wait-free for the owner, Steal is lock-free.
+ *
+ * The underlying ring buffer grows when full. Old buffers might still be read by a concurrent thief,
+ * so they are kept alive until the destruction of the deque.
+ *
+ * \tparam TType Type of the items, must be trivially copyable (typically a pointer)
+ * \see "Correct and Efficient Work-Stealing for Weak Memory Models", Le et al. 2013
+ */
+template <typename TType>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable_v<TType>, "The items of a work stealing deque must be trivially copyable");
+
+    private:
+
+        /**
+         * \brief Ring buffer of the deque, the capacity is always a power of 2
+         */
+        struct Buffer
+        {
+            RkInt64                               capacity;
+            RkInt64                               mask;
+            std::unique_ptr<std::atomic<TType>[]> items;
+
+            explicit Buffer(RkInt64 in_capacity) noexcept;
+
+            [[nodiscard]]
+            TType  Load (RkInt64 in_index) const noexcept;
+            RkVoid Store(RkInt64 in_index, TType in_item) noexcept;
+        };
+
+        #pragma region Members
+
+        // Top and bottom are modified by different threads, keeping them on separate cache lines
+        alignas(64) std::atomic<RkInt64> m_top    {0LL};
+        alignas(64) std::atomic<RkInt64> m_bottom {0LL};
+        alignas(64) std::atomic<Buffer*> m_buffer {nullptr};
+
+        // Every buffer ever allocated by the deque, only accessed by the owner
+        std::vector<std::unique_ptr<Buffer>> m_buffers {};
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Replaces the current buffer by one twice as big
+         * \param in_top Current top of the deque
+         * \param in_bottom Current bottom of the deque
+         * \return New buffer
+         */
+        Buffer* Grow(RkInt64 in_top, RkInt64 in_bottom) noexcept;
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \brief Default constructor
+         * \param in_capacity Initial capacity of the deque, rounded up to the next power of 2
+         */
+        explicit WorkStealingDeque(RkSize in_capacity = 1024ULL) noexcept;
+
+        WorkStealingDeque(WorkStealingDeque const& in_copy) = delete;
+        WorkStealingDeque(WorkStealingDeque&&      in_move) = delete;
+        ~WorkStealingDeque()                                = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Pushes an item at the bottom of the deque
+         * \param in_item Item to push
+         * \warning This must only be called by the owner of the deque
+         */
+        RkVoid Push(TType in_item) noexcept;
+
+        /**
+         * \brief Pops the last pushed item from the bottom of the deque
+         * \param out_item Popped item, only valid if the method returned true
+         * \return True if an item has been popped, false if the deque was empty
+         * \warning This must only be called by the owner of the deque
+         */
+        RkBool Pop(TType& out_item) noexcept;
+
+        /**
+         * \brief Steals the oldest item from the top of the deque, this can be called from any thread
+         * \param out_item Stolen item, only valid if the method returned true
+         * \return True if an item has been stolen, false if the deque was empty or if another thread won the race for the item
+         */
+        RkBool Steal(TType& out_item) noexcept;
+
+        /**
+         * \brief Returns an estimation of the number of items in the deque
+         * \return Approximate size of the deque
+         */
+        [[nodiscard]]
+        RkSize GetSizeEstimate() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        WorkStealingDeque& operator=(WorkStealingDeque const& in_copy) = delete;
+        WorkStealingDeque& operator=(WorkStealingDeque&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+#include "Threading/WorkStealingDeque.inl"
+
+END_RUKEN_NAMESPACE
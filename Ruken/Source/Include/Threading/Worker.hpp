@@ -24,10 +24,12 @@
 
 #pragma once
 
+#include <string>
 #include <thread>
 
 #include "Build/Namespace.hpp"
 #include "Types/FundamentalTypes.hpp"
+#include "Threading/LogicalProcessor.hpp"
 
 BEGIN_RUKEN_NAMESPACE
 
@@ -103,6 +105,22 @@ class Worker
         [[nodiscard]]
         std::thread::id ID() const noexcept;
 
+        /**
+         * \brief Restricts the current thread of the worker to a single logical processor
+         * \param in_processor Processor to run on
+         * \return True if the affinity has been set, false if the worker isn't running or if the platform refused it
+         * \note The affinity is lost once the current job returns, a new job gets a new thread
+         */
+        RkBool SetAffinity(LogicalProcessor const& in_processor) noexcept;
+
+        /**
+         * \brief Names the current thread of the worker, this name shows up in debuggers and profilers
+         * \param in_name Name of the thread, truncated to 15 characters on Linux
+         * \return True if the name has been set
+         * \note The name is lost once the current job returns, a new job gets a new thread
+         */
+        RkBool SetName(std::string const& in_name) noexcept;
+
         #pragma endregion
 
         #pragma region Operators
@@ -0,0 +1,114 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "Build/Namespace.hpp"
+#include "Types/FundamentalTypes.hpp"
+#include "Threading/SchedulerStatistics.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Lock free execution counters of a scheduler thread
+ *
+ * Every worker owns its own counters, on their own cache lines, so recording never contends with another thread.
+ * Counters are only read when aggregating the statistics, reads might be slightly out of date but never block the workers.
+ */
+class alignas(64) WorkerCounters
+{
+    private:
+
+        #pragma region Members
+
+        std::atomic<RkUint64> m_jobs_executed   {0ULL};
+        std::atomic<RkUint64> m_busy_time       {0ULL};
+        std::atomic<RkUint64> m_idle_time       {0ULL};
+        std::atomic<RkUint64> m_queue_depth_sum {0ULL};
+        std::atomic<RkUint64> m_max_queue_depth {0ULL};
+
+        std::array<std::atomic<RkUint64>, scheduler_latency_buckets_count> m_latency_histogram {};
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        WorkerCounters()                              = default;
+        WorkerCounters(WorkerCounters const& in_copy) = delete;
+        WorkerCounters(WorkerCounters&&      in_move) = delete;
+        ~WorkerCounters()                             = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Returns the current time of the clock used by the counters
+         * \return Timestamp in nanoseconds
+         */
+        [[nodiscard]]
+        static RkUint64 GetTimestamp() noexcept;
+
+        /**
+         * \brief Records the execution of a job
+         * \param in_latency Nanoseconds between the scheduling and the start of the job
+         * \param in_duration Nanoseconds spent executing the job, 0 for jobs executed from another job
+         * \param in_queue_depth Number of jobs queued by the executing thread when the job started
+         */
+        RkVoid RecordJob(RkUint64 in_latency, RkUint64 in_duration, RkUint64 in_queue_depth) noexcept;
+
+        /**
+         * \brief Records some time spent waiting for jobs
+         * \param in_duration Idle time in nanoseconds
+         */
+        RkVoid RecordIdleTime(RkUint64 in_duration) noexcept;
+
+        /**
+         * \brief Reads the counters
+         * \param in_elapsed_time Nanoseconds since the last reset, used to compute the utilization
+         * \param out_statistics Statistics of the thread
+         * \param inout_histogram Histogram the latencies are added to
+         */
+        RkVoid Collect(RkUint64 in_elapsed_time, WorkerStatistics& out_statistics, LatencyHistogram& inout_histogram) const noexcept;
+
+        /**
+         * \brief Sets every counter back to 0
+         */
+        RkVoid Reset() noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        WorkerCounters& operator=(WorkerCounters const& in_copy) = delete;
+        WorkerCounters& operator=(WorkerCounters&&      in_move) = delete;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
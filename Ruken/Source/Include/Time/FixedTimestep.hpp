@@ -0,0 +1,121 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma once
+
+#include "Build/Namespace.hpp"
+
+#include "Types/FundamentalTypes.hpp"
+
+BEGIN_RUKEN_NAMESPACE
+
+/**
+ * \brief Drives a simulation at a fixed rate, independently of the rate at which it is called.
+ *
+ * Real time is accumulated every frame, and consumed by steps of a fixed duration.
+ * The left over time (less than a step) is kept for the next frame and exposed as an interpolation
+ * factor, so that rendering can blend between the 2 last simulated states.
+ *
+ * \note The number of steps per frame is clamped to avoid the spiral of death:
+ *       if a step takes longer to simulate than its own duration, the simulation slows down instead of freezing the application.
+ */
+class FixedTimestep
+{
+    private:
+
+        #pragma region Members
+
+        // Real time not simulated yet, always lower than the fixed step after a call to Advance()
+        RkDouble m_accumulator {0.0};
+
+        // Duration of a single simulation step, in seconds
+        RkDouble m_fixed_step {1.0 / 60.0};
+
+        // Maximum number of steps simulated per frame
+        RkUint16 m_max_steps {5U};
+
+        // Total number of steps simulated since the creation of the timestep
+        RkSize m_steps_count {0ULL};
+
+        #pragma endregion
+
+    public:
+
+        #pragma region Constructors
+
+        /**
+         * \brief Default constructor
+         * \param in_fixed_step Duration of a single simulation step, in seconds
+         * \param in_max_steps Maximum number of steps simulated per frame
+         */
+        FixedTimestep(RkDouble in_fixed_step, RkUint16 in_max_steps) noexcept;
+
+        FixedTimestep(FixedTimestep const& in_copy) = default;
+        FixedTimestep(FixedTimestep&&      in_move) = default;
+        ~FixedTimestep()                            = default;
+
+        #pragma endregion
+
+        #pragma region Methods
+
+        /**
+         * \brief Accumulates the elapsed real time and computes the number of simulation steps to run
+         * \param in_elapsed_time Time elapsed since the last call, in seconds
+         * \return Number of simulation steps to run this frame, never more than the max steps count
+         * \note If the max steps count is exceeded, the time that could not be simulated is dropped
+         */
+        RkUint16 Advance(RkDouble in_elapsed_time) noexcept;
+
+        /**
+         * \brief Returns the interpolation factor between the previous and the current simulation state
+         * \return Interpolation factor, between 0 and 1
+         */
+        [[nodiscard]]
+        RkFloat GetInterpolationAlpha() const noexcept;
+
+        /**
+         * \brief Returns the duration of a single simulation step
+         * \return Fixed step, in seconds
+         */
+        [[nodiscard]]
+        RkDouble GetFixedStep() const noexcept;
+
+        /**
+         * \brief Returns the number of simulation steps run since the creation of the timestep
+         * \return Steps count
+         */
+        [[nodiscard]]
+        RkSize GetStepsCount() const noexcept;
+
+        #pragma endregion
+
+        #pragma region Operators
+
+        FixedTimestep& operator=(FixedTimestep const& in_copy) = default;
+        FixedTimestep& operator=(FixedTimestep&&      in_move) = default;
+
+        #pragma endregion
+};
+
+END_RUKEN_NAMESPACE
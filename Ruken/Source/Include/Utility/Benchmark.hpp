@@ -25,6 +25,7 @@
 #pragma once
 
 #include <chrono>
+#include <string>
 
 #include "Build/Namespace.hpp"
 
@@ -43,9 +44,9 @@ class Benchmark
 
         #pragma region Members
 
-        RkChar const*  m_label;
-        RkUint64       m_execution_count;
-        TimePoint       m_time;
+        std::string m_label;
+        RkUint64    m_execution_count;
+        TimePoint   m_time;
 
         #pragma endregion 
 
@@ -55,10 +56,10 @@ class Benchmark
 
         /**
          * \brief Benchmark constructor
-         * \param in_label Label of the benchmark
+         * \param in_label Label of the benchmark, copied so that labels built on the fly can be passed
          * \param in_execution_count Number of times that the benchmarked code will be executed
          */
-        Benchmark (RkChar const*   in_label, RkUint64 in_execution_count) noexcept;
+        Benchmark (std::string     in_label, RkUint64 in_execution_count) noexcept;
         Benchmark (Benchmark const& in_copy)          = default;
         Benchmark (Benchmark&&      in_move) noexcept = default;
         ~Benchmark();
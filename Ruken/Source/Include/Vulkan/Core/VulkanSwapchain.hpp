@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 
 #include "Vulkan/Core/VulkanImage.hpp"
@@ -69,6 +70,13 @@ class VulkanSwapchain
         VkPresentModeKHR              m_present_mode    {VK_PRESENT_MODE_FIFO_KHR};
         std::vector<VulkanImage>      m_images          {};
 
+        static constexpr RkUint64 no_requested_extent = UINT64_MAX;
+
+        // Framebuffer size requested by the window, packed as (width << 32 | height).
+        // The window raises its events on the main thread while the frames are presented from the render job,
+        // the swapchain is thus only recreated by Present()
+        std::atomic<RkUint64> m_requested_extent {no_requested_extent};
+
         #pragma endregion
 
         #pragma region Methods
@@ -139,6 +147,7 @@ class VulkanSwapchain
 
         /**
          * \brief Queues the given frame for presentation.
+         * \note  If the window has been resized since the last presentation, the swapchain is recreated first.
          */
         RkVoid Present(RenderFrame& in_frame) noexcept;
 
@@ -59,6 +59,8 @@ class Material final : public IResource
 
         RkVoid Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor) override;
 
+        ResourceLoadingDescriptor const& KeepLoadingDescriptor(ResourceLoadingDescriptor const& in_descriptor) noexcept override;
+
         RkVoid Reload(ResourceManager& in_manager) override;
 
         RkVoid Unload(ResourceManager& in_manager) noexcept override;
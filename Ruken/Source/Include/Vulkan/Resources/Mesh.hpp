@@ -82,6 +82,8 @@ class Mesh final : public IResource
 
         RkVoid Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor) override;
 
+        ResourceLoadingDescriptor const& KeepLoadingDescriptor(ResourceLoadingDescriptor const& in_descriptor) noexcept override;
+
         RkVoid Reload(ResourceManager& in_manager) override;
 
         RkVoid Unload(ResourceManager& in_manager) noexcept override;
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <span>
 #include <optional>
 
 #include "Resource/IResource.hpp"
@@ -79,6 +80,13 @@ class Texture final : public IResource
 
         RkVoid Load(ResourceManager& in_manager, ResourceLoadingDescriptor const& in_descriptor) override;
 
+        ResourceLoadingDescriptor const& KeepLoadingDescriptor(ResourceLoadingDescriptor const& in_descriptor) noexcept override;
+
+        [[nodiscard]]
+        RkChar const* GetSourcePath() const noexcept override;
+
+        RkVoid LoadFromSource(ResourceManager& in_manager, std::optional<std::span<RkByte const>> in_source) override;
+
         RkVoid Reload(ResourceManager& in_manager) override;
 
         RkVoid Unload(ResourceManager& in_manager) noexcept override;
@@ -26,8 +26,16 @@ template <typename TType, RkSize TChunkSize>
 LinkedChunkList<TType, TChunkSize>::~LinkedChunkList()
 {
     // Removing all the nodes from the head to the tail
-    while (m_tail != nullptr)
-        DeleteNode(*m_head);
+    Node* node = m_head.load(std::memory_order_relaxed);
+
+    while (node != nullptr)
+    {
+        Node* const next_node = node->next_node.load(std::memory_order_relaxed);
+
+        delete node;
+
+        node = next_node;
+    }
 }
 
 #pragma region Getters
@@ -35,19 +43,19 @@ LinkedChunkList<TType, TChunkSize>::~LinkedChunkList()
 template <typename TType, RkSize TChunkSize>
 RkSize LinkedChunkList<TType, TChunkSize>::GetSize() const noexcept
 {
-    return m_size;
+    return m_size.load(std::memory_order_acquire);
 }
 
 template <typename TType, RkSize TChunkSize>
 typename LinkedChunkList<TType, TChunkSize>::Node* LinkedChunkList<TType, TChunkSize>::GetHead() const noexcept
 {
-    return m_head;
+    return m_head.load(std::memory_order_acquire);
 }
 
 template <typename TType, RkSize TChunkSize>
 typename LinkedChunkList<TType, TChunkSize>::Node* LinkedChunkList<TType, TChunkSize>::GetTail() const noexcept
 {
-    return m_tail;
+    return m_tail.load(std::memory_order_acquire);
 }
 
 #pragma endregion 
@@ -57,22 +65,24 @@ typename LinkedChunkList<TType, TChunkSize>::Node* LinkedChunkList<TType, TChunk
 template <typename TType, RkSize TChunkSize>
 typename LinkedChunkList<TType, TChunkSize>::Node& LinkedChunkList<TType, TChunkSize>::CreateNode() noexcept
 {
-    Node* new_node = new Node();
-    m_size++;
+    Node*        new_node = new Node();
+    Node*  const tail     = m_tail.load(std::memory_order_relaxed);
+    RkSize const size     = m_size.load(std::memory_order_relaxed);
 
-    // If the list is empty
-    if (m_tail == nullptr)
-    {
-        m_head = new_node;
-        m_tail = new_node;
+    // The node is entirely initialized before being published, readers never see a partially linked node
+    new_node->prev_node = tail;
+    new_node->index     = size;
 
-        return *new_node;
-    }
+    // If the list is empty
+    if (tail == nullptr)
+        m_head.store(new_node, std::memory_order_release);
 
     // Otherwise if the list has at least one node, inserting it at the end
-    m_tail  ->next_node = new_node;
-    new_node->prev_node = m_tail;
-    m_tail              = new_node;
+    else
+        tail->next_node.store(new_node, std::memory_order_release);
+
+    m_tail.store(new_node, std::memory_order_release);
+    m_size.store(size + 1ULL, std::memory_order_release);
 
     return *new_node;
 }
@@ -80,23 +90,28 @@ typename LinkedChunkList<TType, TChunkSize>::Node& LinkedChunkList<TType, TChunk
 template <typename TType, RkSize TChunkSize>
 RkVoid LinkedChunkList<TType, TChunkSize>::DeleteNode(Node& in_node) noexcept
 {
+    Node* const next_node = in_node.next_node.load(std::memory_order_relaxed);
+
     // Updating the head
-    if (m_head == &in_node)
-        m_head = in_node.next_node;
+    if (m_head.load(std::memory_order_relaxed) == &in_node)
+        m_head.store(next_node, std::memory_order_release);
 
     // Updating the tail
-    if (m_tail == &in_node)
-        m_tail = in_node.prev_node;
+    if (m_tail.load(std::memory_order_relaxed) == &in_node)
+        m_tail.store(in_node.prev_node, std::memory_order_release);
+
+    // Updating the next pointer, and the position of every following node
+    if (next_node != nullptr)
+        next_node->prev_node = in_node.prev_node;
 
-    // Updating the next pointer
-    if (in_node.next_node != nullptr)
-        in_node.next_node->prev_node = in_node.prev_node;
+    for (Node* node = next_node; node != nullptr; node = node->next_node.load(std::memory_order_relaxed))
+        --node->index;
 
     // Updating the prev pointer
     if (in_node.prev_node != nullptr)
-        in_node.prev_node->next_node = in_node.next_node;
+        in_node.prev_node->next_node.store(next_node, std::memory_order_release);
 
-    m_size--;
+    m_size.fetch_sub(1ULL, std::memory_order_release);
 
     delete &in_node;
 }
@@ -104,31 +119,26 @@ RkVoid LinkedChunkList<TType, TChunkSize>::DeleteNode(Node& in_node) noexcept
 template <typename TType, RkSize TChunkSize>
 typename LinkedChunkList<TType, TChunkSize>::Node* LinkedChunkList<TType, TChunkSize>::GetNode(RkSize const in_node_index) const noexcept
 {
-    // Tail optimization
-    if (in_node_index == m_size)
-        return m_tail;
-
-    // Head optimization
-    if (in_node_index == 0)
-        return m_head;
+    // The tail carries its own position, so both the tail and the walks below stay consistent if the list grows meanwhile
+    Node* const tail = m_tail.load(std::memory_order_acquire);
 
-    if (in_node_index > m_size)
+    if (tail == nullptr || in_node_index > tail->index)
         return nullptr;
 
     // Checking if the node is closer to the beginning or the end
-    if (in_node_index < m_size / 2)
+    if (in_node_index < tail->index / 2)
     {
         // Forward iteration
-        Node* node = m_head;
+        Node* node = m_head.load(std::memory_order_acquire);
         for (RkSize index = 0ULL; index < in_node_index; ++index)
-            node = node->next_node;
+            node = node->next_node.load(std::memory_order_acquire);
 
         return node;
     }
 
-    // Backward iteration
-    Node* node = m_tail;
-    for (RkSize index = 0ULL; index < m_size - in_node_index; ++index)
+    // Backward iteration, previous nodes are never modified once published
+    Node* node = tail;
+    for (RkSize index = in_node_index; index < tail->index; ++index)
         node = node->prev_node;
 
     return node;
@@ -138,7 +148,7 @@ template <typename TType, RkSize TChunkSize>
 template <typename TLambda>
 RkVoid LinkedChunkList<TType, TChunkSize>::Foreach(TLambda in_lambda) noexcept
 {
-    for (Node* current_node = m_head; current_node != nullptr; current_node = current_node->next_node)
+    for (Node* current_node = m_head.load(std::memory_order_acquire); current_node != nullptr; current_node = current_node->next_node.load(std::memory_order_acquire))
         in_lambda(*current_node);
 }
 
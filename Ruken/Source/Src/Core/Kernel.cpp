@@ -22,6 +22,7 @@
  *  SOFTWARE.
  */
 
+#include <chrono>
 #include <iostream>
 
 #include "Build/Info.hpp"
@@ -34,6 +35,10 @@
 #include "Meta/Meta.hpp"
 #include "Meta/Safety.hpp"
 
+#include "IO/IOService.hpp"
+#include "ECS/EntityAdmin.hpp"
+#include "Time/ControlClock.hpp"
+#include "Memory/FrameAllocator.hpp"
 #include "Rendering/Renderer.hpp"
 #include "Threading/Scheduler.hpp"
 #include "Windowing/WindowManager.hpp"
@@ -41,7 +46,8 @@
 
 USING_RUKEN_NAMESPACE
 
-Kernel::Kernel()
+Kernel::Kernel():
+    m_simulation_step {RUKEN_SIMULATION_FIXED_STEP, RUKEN_SIMULATION_MAX_STEPS}
 {
     #if defined(RUKEN_LOGGING_ENABLED)
 
@@ -65,9 +71,11 @@ Kernel::Kernel()
     SetupService<KernelProxy>(true, *this);
 
     SetupService<Scheduler>      (true);
+    SetupService<IOService>      (true);
     SetupService<WindowManager>  (true);
     SetupService<Renderer>       (true);
     SetupService<ResourceManager>(true);
+    SetupService<EntityAdmin>    (true);
 
     m_console_handler.Flush();
 }
@@ -94,19 +102,70 @@ RkInt Kernel::Run() noexcept
         }
     });
 
+    auto& entity_admin = *m_service_provider.LocateService<EntityAdmin>();
+    auto& scheduler    = *m_service_provider.LocateService<Scheduler>();
+
+    // Null if the renderer failed to initialize
+    FramePipeline* frame_pipeline = m_service_provider.LocateService<Renderer>()->GetFramePipeline();
+
+    // The frame clock measures the real time spent per frame and
+    // sleeps the remaining time if the frame was faster than the max frame rate
+    ControlClock frame_clock;
+    frame_clock.SetControlFrequency(1.0F / RUKEN_KERNEL_MAX_FRAME_RATE);
+
+    entity_admin.StartSimulation();
+
+    RkSize frames_count = 0ULL;
+
+    // The control clock only reports the requested sleep time, the simulation is advanced by
+    // the measured time between two control points instead so that oversleeping is accounted for
+    std::chrono::steady_clock::time_point last_control_point = std::chrono::steady_clock::now();
+
     // Main kernel loop
     while (!m_shutdown_requested.load(std::memory_order_acquire))
     {
+        frame_clock.ControlPoint();
+
+        std::chrono::steady_clock::time_point const control_point = std::chrono::steady_clock::now();
+        RkDouble const elapsed_time = std::chrono::duration<RkDouble>(control_point - last_control_point).count();
+        last_control_point = control_point;
+
+        // Every frame allocation of the previous frame is now released
+        FrameAllocator::NextFrame();
+
         // Updating services that needs to
         window_manager.Update();
 
         if (window.ShouldClose())
             RequestShutdown(0);
 
+        // Simulating the elapsed time by fixed steps
+        RkUint16 const steps = m_simulation_step.Advance(elapsed_time);
+        for (RkUint16 step = 0U; step < steps; ++step)
+            entity_admin.UpdateSimulation();
+
+        // Extracting the render state of the frame, the frame is then rendered while the next one is simulated
+        if (frame_pipeline)
+            frame_pipeline->SubmitFrame(m_simulation_step.GetInterpolationAlpha());
+
+        if constexpr (RUKEN_SCHEDULER_STATISTICS_LOG_PERIOD > 0ULL)
+        {
+            if (++frames_count % RUKEN_SCHEDULER_STATISTICS_LOG_PERIOD == 0ULL)
+            {
+                scheduler.LogStatisticsSummary();
+                scheduler.ResetStatistics();
+            }
+        }
+
         // Displaying logs to the console
         m_console_handler.Flush();
     }
 
+    if (frame_pipeline)
+        frame_pipeline->Flush();
+
+    entity_admin.EndSimulation();
+
     // Exit
     RUKEN_SAFE_LOGGER_CALL(m_logger, Info("Cleanup done, exiting application"))
 
@@ -120,3 +179,8 @@ RkVoid Kernel::RequestShutdown(RkInt const in_exit_code) noexcept
     m_exit_code = in_exit_code;
     m_shutdown_requested.store(true, std::memory_order_release);
 }
+
+FixedTimestep const& Kernel::GetSimulationTimestep() const noexcept
+{
+    return m_simulation_step;
+}
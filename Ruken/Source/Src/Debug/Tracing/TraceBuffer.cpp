@@ -0,0 +1,107 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <bit>
+#include <algorithm>
+
+#include "Debug/Tracing/TraceBuffer.hpp"
+
+USING_RUKEN_NAMESPACE
+
+TraceBuffer::TraceBuffer(RkSize const in_capacity, RkSize const in_thread_id) noexcept:
+    m_slots     {std::make_unique<Slot[]>(std::bit_ceil(std::max<RkSize>(in_capacity, 1ULL)))},
+    m_mask      {std::bit_ceil(std::max<RkSize>(in_capacity, 1ULL)) - 1ULL},
+    m_thread_id {in_thread_id}
+{}
+
+RkVoid TraceBuffer::Push(TraceEvent const& in_event) noexcept
+{
+    RkSize const head = m_head.load(std::memory_order_relaxed);
+    Slot&        slot = m_slots[head & m_mask];
+
+    // Orders the publication of the previous head before overwriting the slot,
+    // any reader seeing the new content of the slot will then see that it has been overwritten
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.name     .store(in_event.name,      std::memory_order_relaxed);
+    slot.category .store(in_event.category,  std::memory_order_relaxed);
+    slot.timestamp.store(in_event.timestamp, std::memory_order_relaxed);
+    slot.phase    .store(in_event.phase,     std::memory_order_relaxed);
+
+    m_head.store(head + 1ULL, std::memory_order_release);
+}
+
+RkVoid TraceBuffer::Clear() noexcept
+{
+    m_first.store(m_head.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+std::vector<TraceEvent> TraceBuffer::GetEvents() const noexcept
+{
+    RkSize const capacity = m_mask + 1ULL;
+    RkSize const head     = m_head.load(std::memory_order_acquire);
+    RkSize const first    = std::max(m_first.load(std::memory_order_acquire), head - std::min(head, capacity));
+
+    std::vector<TraceEvent> events {};
+    events.reserve(head - std::min(head, first));
+
+    for (RkSize index = first; index < head; ++index)
+    {
+        Slot const& slot = m_slots[index & m_mask];
+
+        events.push_back(TraceEvent {
+            .name      = slot.name     .load(std::memory_order_relaxed),
+            .category  = slot.category .load(std::memory_order_relaxed),
+            .timestamp = slot.timestamp.load(std::memory_order_relaxed),
+            .phase     = slot.phase    .load(std::memory_order_relaxed)
+        });
+    }
+
+    // Checking which slots have been overwritten during the copy, the event at a given index
+    // is overwritten by the push of index + capacity, which starts once the head reached that index
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    RkSize const final_head  = m_head.load(std::memory_order_relaxed);
+    RkSize const overwritten = final_head >= capacity ? std::min<RkSize>(final_head - capacity + 1ULL, head) : 0ULL;
+
+    if (overwritten > first)
+        events.erase(events.begin(), events.begin() + static_cast<std::ptrdiff_t>(std::min(overwritten - first, events.size())));
+
+    return events;
+}
+
+RkVoid TraceBuffer::SetThreadName(std::string const& in_name) noexcept
+{
+    m_thread_name = in_name;
+}
+
+RkSize TraceBuffer::GetThreadId() const noexcept
+{
+    return m_thread_id;
+}
+
+std::string const& TraceBuffer::GetThreadName() const noexcept
+{
+    return m_thread_name;
+}
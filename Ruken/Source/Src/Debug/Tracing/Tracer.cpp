@@ -0,0 +1,169 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+#include <string_view>
+
+#include "Build/Config.hpp"
+#include "Debug/Tracing/Tracer.hpp"
+
+USING_RUKEN_NAMESPACE
+
+TraceBuffer& Tracer::GetThreadBuffer() noexcept
+{
+    if (!m_thread_buffer)
+    {
+        std::lock_guard<std::mutex> lock(m_buffers_mutex);
+
+        m_thread_buffer = m_buffers.emplace_back(std::make_unique<TraceBuffer>(RUKEN_TRACE_BUFFER_CAPACITY, m_buffers.size())).get();
+        m_thread_buffer->SetThreadName(m_thread_name);
+    }
+
+    return *m_thread_buffer;
+}
+
+RkVoid Tracer::Record(RkChar const* in_name, RkChar const* in_category, RkChar const in_phase) noexcept
+{
+    GetThreadBuffer().Push(TraceEvent {
+        .name      = in_name,
+        .category  = in_category,
+        .timestamp = GetTimestamp(),
+        .phase     = in_phase
+    });
+}
+
+RkVoid Tracer::Start() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_buffers_mutex);
+
+        for (std::unique_ptr<TraceBuffer>& buffer: m_buffers)
+            buffer->Clear();
+    }
+
+    m_start_time.store(GetTimestamp(), std::memory_order_relaxed);
+    m_enabled   .store(true,           std::memory_order_release);
+}
+
+RkVoid Tracer::Stop() noexcept
+{
+    m_enabled.store(false, std::memory_order_release);
+}
+
+RkUint64 Tracer::GetTimestamp() noexcept
+{
+    return static_cast<RkUint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+RkVoid Tracer::Begin(RkChar const* in_name, RkChar const* in_category) noexcept
+{
+    Record(in_name, in_category, 'B');
+}
+
+RkVoid Tracer::End(RkChar const* in_name, RkChar const* in_category) noexcept
+{
+    Record(in_name, in_category, 'E');
+}
+
+RkVoid Tracer::Instant(RkChar const* in_name, RkChar const* in_category) noexcept
+{
+    Record(in_name, in_category, 'i');
+}
+
+RkVoid Tracer::SetCurrentThreadName(std::string const& in_name) noexcept
+{
+    m_thread_name = in_name;
+
+    if (m_thread_buffer)
+    {
+        std::lock_guard<std::mutex> lock(m_buffers_mutex);
+
+        m_thread_buffer->SetThreadName(in_name);
+    }
+}
+
+RkBool Tracer::Dump(std::string const& in_path) noexcept
+{
+    std::ofstream file(in_path, std::ios::out | std::ios::trunc);
+    if (!file)
+        return false;
+
+    // Names are expected to be identifiers, but a few characters still need to be escaped to produce valid json
+    auto const escape = [](std::string_view const in_string) {
+        std::string escaped {};
+        escaped.reserve(in_string.size());
+
+        for (RkChar const character: in_string)
+        {
+            if (character == '"' || character == '\\')
+                escaped.push_back('\\');
+
+            if (static_cast<unsigned char>(character) >= 0x20U)
+                escaped.push_back(character);
+        }
+
+        return escaped;
+    };
+
+    RkUint64 const start_time  = m_start_time.load(std::memory_order_relaxed);
+    RkBool         first_event = true;
+
+    file << "{\"traceEvents\":[\n";
+
+    std::lock_guard<std::mutex> lock(m_buffers_mutex);
+
+    for (std::unique_ptr<TraceBuffer> const& buffer: m_buffers)
+    {
+        for (TraceEvent const& event: buffer->GetEvents())
+        {
+            // Timestamps are expressed in microseconds
+            RkUint64 const time = event.timestamp - std::min(start_time, event.timestamp);
+
+            file << (first_event ? "" : ",\n")
+                 << "{\"name\":\"" << escape(event.name     ? event.name     : "") << "\","
+                 << "\"cat\":\""   << escape(event.category ? event.category : "") << "\","
+                 << "\"ph\":\""    << event.phase << "\","
+                 << "\"ts\":"      << time / 1000ULL << '.' << std::to_string(1000ULL + time % 1000ULL).substr(1) << ','
+                 << "\"pid\":1,\"tid\":" << buffer->GetThreadId()
+                 << (event.phase == 'i' ? ",\"s\":\"t\"}" : "}");
+
+            first_event = false;
+        }
+
+        if (!buffer->GetThreadName().empty())
+        {
+            file << (first_event ? "" : ",\n")
+                 << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->GetThreadId()
+                 << ",\"args\":{\"name\":\"" << escape(buffer->GetThreadName()) << "\"}}";
+
+            first_event = false;
+        }
+    }
+
+    file << "\n]}\n";
+
+    return file.good();
+}
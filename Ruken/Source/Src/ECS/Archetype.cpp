@@ -22,8 +22,12 @@
  *  SOFTWARE.
  */
 
+#include <algorithm>
+
 #include <Common/Numerics.hpp>
 
+#include "Build/Config.hpp"
+
 #include "ECS/Range.hpp"
 #include "ECS/Archetype.hpp"
 
@@ -43,9 +47,147 @@ RkSize Archetype::GetFreeEntityLocation() noexcept
 
     --m_free_space_count;
 
+    ResetRecycling();
+
     return location;
 }
 
+RkVoid Archetype::ReleaseLocation(RkSize const in_location) noexcept
+{
+    ReleaseRange(Range(in_location, 1ULL));
+}
+
+RkVoid Archetype::ReleaseRange(Range const& in_range) noexcept
+{
+    if (in_range.size == 0ULL)
+        return;
+
+    m_free_space_count += in_range.size;
+
+    ResetRecycling();
+
+    // Looking for the first range after the released one, the free ranges are kept sorted
+    std::list<Range>::iterator next = std::find_if(m_free_entities.begin(), m_free_entities.end(), [&in_range](Range const& in_free_range) {
+        return in_free_range.begin > in_range.begin;
+    });
+
+    // Merging with the previous range if they are contiguous, and with the next one if the gap is now closed
+    if (next != m_free_entities.begin())
+    {
+        std::list<Range>::iterator const previous = std::prev(next);
+
+        if (previous->begin + previous->size == in_range.begin)
+        {
+            previous->size += in_range.size;
+
+            if (next != m_free_entities.end() && previous->begin + previous->size == next->begin)
+            {
+                previous->size += next->size;
+                m_free_entities.erase(next);
+            }
+
+            return;
+        }
+    }
+
+    // Merging with the next range only
+    if (next != m_free_entities.end() && in_range.begin + in_range.size == next->begin)
+    {
+        next->begin  = in_range.begin;
+        next->size  += in_range.size;
+
+        return;
+    }
+
+    m_free_entities.insert(next, in_range);
+}
+
+RkVoid Archetype::ClaimRange(Range const& in_range) noexcept
+{
+    if (in_range.size == 0ULL)
+        return;
+
+    m_free_space_count -= in_range.size;
+
+    ResetRecycling();
+
+    // Looking for the free range containing the claimed one
+    std::list<Range>::iterator const free_range = std::find_if(m_free_entities.begin(), m_free_entities.end(), [&in_range](Range const& in_free_range) {
+        return in_free_range.begin + in_free_range.size > in_range.begin;
+    });
+
+    RkSize const tail_begin = in_range.begin + in_range.size;
+    RkSize const tail_size  = free_range->begin + free_range->size - tail_begin;
+
+    // Claiming the beginning of the free range
+    if (free_range->begin == in_range.begin)
+    {
+        free_range->begin = tail_begin;
+        free_range->size  = tail_size;
+
+        if (tail_size == 0ULL)
+            m_free_entities.erase(free_range);
+
+        return;
+    }
+
+    // Otherwise splitting the free range in two
+    free_range->size = in_range.begin - free_range->begin;
+
+    if (tail_size > 0ULL)
+        m_free_entities.insert(std::next(free_range), Range(tail_begin, tail_size));
+}
+
+RkVoid Archetype::ResetRecycling() noexcept
+{
+    m_recycling_range  = m_free_entities.cbegin();
+    m_recycling_offset = 0ULL;
+}
+
+RkVoid Archetype::EnsureRowStorage(RkSize const in_rows_count) noexcept
+{
+    // Fast path, the storage is already big enough
+    if (in_rows_count <= m_rows_capacity.load(std::memory_order_acquire))
+        return;
+
+    std::lock_guard<std::mutex> lock(m_storage_mutex);
+
+    // Another thread might have grown the storage while we were waiting for the lock
+    RkSize const capacity = m_rows_capacity.load(std::memory_order_relaxed);
+    if (in_rows_count <= capacity)
+        return;
+
+    // allocated_elements returns the minimum number of elements a component successfully allocated
+    // This is used to reduce the number of calls to this function to the bare minimum
+    // speeding up the creation process of an entity
+    RkSize allocated_elements = 0ULL;
+    for (auto& [id, component]: m_components)
+        allocated_elements = MinExceptZero(component->EnsureStorageSpace(in_rows_count), allocated_elements);
+
+    // Components without any storage (tags) never allocate anything, in which case
+    // the storage is only guaranteed for the requested rows
+    m_rows_capacity.store(std::max(in_rows_count, capacity + allocated_elements), std::memory_order_release);
+}
+
+Archetype::RowsReservation& Archetype::GetThreadReservation() noexcept
+{
+    // Every thread caches the reservations it owns, keyed by archetype instance
+    thread_local std::unordered_map<RkSize, RowsReservation*> thread_reservations;
+
+    auto const it = thread_reservations.find(m_instance_id);
+    if (it != thread_reservations.end())
+        return *it->second;
+
+    // First reservation of this thread in this archetype, registering it to be able to commit it later on.
+    // This only happens once per thread and per archetype.
+    std::lock_guard<std::mutex> lock(m_reservations_mutex);
+
+    RowsReservation& reservation = m_reservations.emplace_back();
+    thread_reservations.emplace(m_instance_id, &reservation);
+
+    return reservation;
+}
+
 ArchetypeFingerprint const& Archetype::GetFingerprint() const noexcept
 {
     return m_fingerprint;
@@ -53,73 +195,154 @@ ArchetypeFingerprint const& Archetype::GetFingerprint() const noexcept
 
 RkSize Archetype::GetEntitiesCount() const noexcept
 {
-    return m_entities_count;
+    return m_entities_count.load(std::memory_order_acquire);
 }
 
-Entity Archetype::CreateEntity() noexcept
+RkSize Archetype::GetRowsCount() const noexcept
 {
-    // If there are no more free space for entities, that means that we might have to allocate some more
-    // to store the new data
-    if (m_free_space_count == 0ULL)
-    {
-        // allocated_elements returns the minimum number of elements a component successfully allocated
-        // This is used to reduce the number of calls to this function to the bare minimum
-        // speeding up the creation process of an entity
-        RkSize allocated_elements = UINT64_MAX;
-        for (auto& [id, component]: m_components)
-            allocated_elements = MinExceptZero(component->EnsureStorageSpace(m_entities_count + 1), allocated_elements);
-
-        // Since the EnsureStorageSpace is always called when there is no more free entity available, allocated_elements should always
-        // be at a minimum of 1, which means that the free space count cannot decrease here
-        m_free_space_count += allocated_elements - 1;
-
-        // If the number of allocated elements (entities) is greater than one
-        // ie. that some entities are left unconsumed, we need to declare a free entity range for that
-        if (allocated_elements > 1)
-            m_free_entities.emplace_back(Range(m_entities_count + 1, allocated_elements - 1));
-
-        // Creating the entity
-        return Entity(*this, m_entities_count++);
-    }
+    return m_rows_count.load(std::memory_order_acquire);
+}
 
-    // Otherwise, fetching an entity id from a free location
-    ++m_entities_count;
-    return Entity(*this, GetFreeEntityLocation());
+RkSize Archetype::GetCommittedRowsCount() const noexcept
+{
+    return m_committed_rows_count.load(std::memory_order_acquire);
 }
 
-RkVoid Archetype::DeleteEntity(RkSize in_local_identifier) noexcept
+ArchetypeStatistics Archetype::GetStatistics() const noexcept
 {
-    ++m_free_space_count;
-    --m_entities_count;
+    ArchetypeStatistics statistics {};
+
+    statistics.entities_count    = m_entities_count.load(std::memory_order_acquire);
+    statistics.rows_count        = m_rows_count    .load(std::memory_order_acquire);
+    statistics.capacity          = m_rows_capacity .load(std::memory_order_acquire);
+    statistics.free_ranges_count = m_free_entities.size();
 
-    // If there are no ranges yet, creating the first one
-    if (m_free_entities.empty())
+    for (Range const& range: m_free_entities)
+        statistics.free_entities_count += range.size;
+
+    statistics.components.reserve(m_components.size());
+    for (auto const& [id, component]: m_components)
     {
-        m_free_entities.emplace_front(in_local_identifier, 1ULL);
-        return;
+        ComponentStatistics& component_statistics = statistics.components.emplace_back();
+
+        component_statistics.component_id = id;
+        component->CollectStatistics(component_statistics);
+
+        for (FieldStatistics const& field: component_statistics.fields)
+            statistics.allocated_bytes += field.allocated_bytes;
     }
 
-    // Checking if any empty range can be expanded
-    for (std::list<Range>::iterator it = m_free_entities.begin(); it != m_free_entities.end(); ++it)
+    if (statistics.capacity > 0ULL)
+        statistics.chunk_utilization = static_cast<RkFloat>(statistics.entities_count) / static_cast<RkFloat>(statistics.capacity);
+
+    return statistics;
+}
+
+Entity Archetype::CreateEntity() noexcept
+{
+    m_entities_count.fetch_add(1ULL, std::memory_order_relaxed);
+
+    // Fetching an entity id from a free location if there is one
+    if (m_free_space_count > 0ULL)
+        return Entity(*this, GetFreeEntityLocation());
+
+    // Otherwise, we might have to allocate some more memory to store the new data
+    RkSize const location = m_rows_count.fetch_add(1ULL, std::memory_order_relaxed);
+    EnsureRowStorage(location + 1ULL);
+
+    m_committed_rows_count.store(location + 1ULL, std::memory_order_release);
+
+    return Entity(*this, location);
+}
+
+RkVoid Archetype::RefillReservation(RowsReservation& io_reservation) noexcept
+{
     {
-        if (it->begin - 1ULL == in_local_identifier)
-        {
-            it->ExpandLeft();
-            return;
-        }
+        std::lock_guard<std::mutex> lock(m_reservations_mutex);
 
-        if (it->begin > in_local_identifier)
-        {
-            m_free_entities.insert(it, Range(in_local_identifier, 1ULL));
-            return;
-        }
+        // The consumed block has been entirely claimed, its rows will leave the free ranges at the next synchronization point
+        if (io_reservation.recycled)
+            m_recycled_rows.push_back(io_reservation.rows);
 
-        if (it->begin + it->size == in_local_identifier)
+        // Recycling the free rows first, these already have storage.
+        // The free ranges are left untouched until the next synchronization point, views can keep reading them meanwhile
+        for (; m_recycling_range != m_free_entities.cend(); ++m_recycling_range, m_recycling_offset = 0ULL)
         {
-            it->ExpandRight();
+            RkSize const available = m_recycling_range->size - m_recycling_offset;
+
+            if (available == 0ULL)
+                continue;
+
+            RkSize const size = std::min<RkSize>(available, RUKEN_ECS_RESERVATION_BLOCK_SIZE);
+
+            io_reservation.rows     = Range(m_recycling_range->begin + m_recycling_offset, size);
+            io_reservation.claimed  = 0ULL;
+            io_reservation.recycled = true;
+
+            m_recycling_offset += size;
+
             return;
         }
     }
+
+    // Otherwise growing the archetype, the new rows are past the committed rows count and thus never visited by the views
+    io_reservation.rows     = Range(m_rows_count.fetch_add(RUKEN_ECS_RESERVATION_BLOCK_SIZE, std::memory_order_relaxed), RUKEN_ECS_RESERVATION_BLOCK_SIZE);
+    io_reservation.claimed  = 0ULL;
+    io_reservation.recycled = false;
+
+    EnsureRowStorage(io_reservation.rows.begin + io_reservation.rows.size);
+}
+
+Entity Archetype::CreateEntityConcurrently() noexcept
+{
+    RowsReservation& reservation = GetThreadReservation();
+
+    // If the reservation has been consumed, claiming a new block of rows
+    if (reservation.claimed == reservation.rows.size)
+        RefillReservation(reservation);
+
+    RkSize const location = reservation.rows.begin + reservation.claimed++;
+
+    m_entities_count.fetch_add(1ULL, std::memory_order_relaxed);
+
+    return Entity(*this, location);
+}
+
+RkVoid Archetype::CommitReservations() noexcept
+{
+    std::lock_guard<std::mutex> lock(m_reservations_mutex);
+
+    // Recycled rows used by an entity leave the free ranges
+    for (Range const& recycled_rows: m_recycled_rows)
+        ClaimRange(recycled_rows);
+
+    m_recycled_rows.clear();
+
+    for (RowsReservation& reservation: m_reservations)
+    {
+        Range const claimed  (reservation.rows.begin, reservation.claimed);
+        Range const unclaimed(reservation.rows.begin + reservation.claimed, reservation.rows.size - reservation.claimed);
+
+        // Unclaimed recycled rows simply stay free, while unclaimed grown rows become regular free locations
+        if (reservation.recycled)
+            ClaimRange(claimed);
+        else
+            ReleaseRange(unclaimed);
+
+        reservation = RowsReservation();
+    }
+
+    // Every grown row now has storage and is either used by an entity or free, making them visible to the views
+    m_committed_rows_count.store(m_rows_count.load(std::memory_order_relaxed), std::memory_order_release);
+
+    ResetRecycling();
+}
+
+RkVoid Archetype::DeleteEntity(RkSize const in_local_identifier) noexcept
+{
+    m_entities_count.fetch_sub(1ULL, std::memory_order_relaxed);
+
+    ReleaseLocation(in_local_identifier);
 }
 
 std::list<Range> const& Archetype::GetFreeEntitiesRanges() const noexcept
@@ -0,0 +1,54 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+template <RkSize TBufferCount, ComponentFieldType... TFields>
+BufferedExclusiveComponent<TBufferCount, TFields...>::BufferedExclusiveComponent() noexcept:
+    ComponentBase {nullptr}
+{ }
+
+#pragma warning(push)
+#pragma warning(disable : 4702) // unreachable code
+
+template <RkSize TBufferCount, ComponentFieldType... TFields>
+RkSize BufferedExclusiveComponent<TBufferCount, TFields...>::EnsureStorageSpace(RkSize) noexcept
+{
+    RUKEN_ASSERT_MESSAGE(false, "This method should never be called on a BufferedExclusiveComponent");
+
+    return 0ULL;
+}
+
+#pragma warning(pop)
+
+template <RkSize TBufferCount, ComponentFieldType... TFields>
+RkVoid BufferedExclusiveComponent<TBufferCount, TFields...>::Publish() noexcept
+{
+    RkSize const published_index = m_back_index;
+
+    m_front_index.store(published_index, std::memory_order_release);
+
+    // The writer continues from the state it just published, the buffer
+    // it moves onto is the oldest one, that no reader can be looking at anymore
+    m_back_index            = (published_index + 1ULL) % TBufferCount;
+    m_buffers[m_back_index] = m_buffers[published_index];
+}
@@ -29,3 +29,9 @@ USING_RUKEN_NAMESPACE
 ComponentBase::ComponentBase(Archetype const* in_owning_archetype) noexcept:
     m_owning_archetype {in_owning_archetype}
 { }
+
+RkVoid ComponentBase::CollectStatistics(ComponentStatistics&) const noexcept
+{ }
+
+RkVoid ComponentBase::Publish() noexcept
+{ }
@@ -56,6 +56,26 @@ RkSize ComponentLayout<TFields...>::EnsureStorageSpaceHelper(ContainerType& in_c
     );
 }
 
+template <ComponentFieldType... TFields>
+template <RkSize... TIds>
+RkVoid ComponentLayout<TFields...>::CollectStatisticsHelper(ContainerType const& in_container, ComponentStatistics& out_statistics, std::index_sequence<TIds...>) noexcept
+{
+    out_statistics.fields.reserve(out_statistics.fields.size() + sizeof...(TFields));
+
+    ([&out_statistics](LinkedChunkList<typename TFields::Type> const& in_list)
+    {
+        using Node = typename LinkedChunkList<typename TFields::Type>::Node;
+
+        out_statistics.fields.emplace_back(FieldStatistics {
+            .element_size        = sizeof(typename TFields::Type),
+            .chunk_element_count = in_list.chunk_element_count,
+            .chunks_count        = in_list.GetSize(),
+            .allocated_bytes     = in_list.GetSize() * sizeof(Node)
+        });
+
+    }(std::get<TIds>(in_container)), ...);
+}
+
 template <ComponentFieldType... TFields>
 template <ViewType TView>
 TView ComponentLayout<TFields...>::GetView(ContainerType const& in_container, Archetype const& in_owning_archetype) noexcept
@@ -69,4 +89,10 @@ RkSize ComponentLayout<TFields...>::EnsureStorageSpace(ContainerType& in_contain
     return EnsureStorageSpaceHelper(in_container, in_size, std::make_index_sequence<sizeof...(TFields)>());
 }
 
+template <ComponentFieldType... TFields>
+RkVoid ComponentLayout<TFields...>::CollectStatistics(ContainerType const& in_container, ComponentStatistics& out_statistics) noexcept
+{
+    CollectStatisticsHelper(in_container, out_statistics, std::make_index_sequence<sizeof...(TFields)>());
+}
+
 #pragma endregion
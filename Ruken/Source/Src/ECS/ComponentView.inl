@@ -34,12 +34,18 @@ ComponentView<TPack<TIndices...>, TFields...>::ComponentView(Archetype const& in
 template <template <RkSize...> class TPack, RkSize... TIndices, ComponentFieldType... TFields>
 RkBool ComponentView<TPack<TIndices...>, TFields...>::FindNextEntity() noexcept
 {
-    // Stores the increase required in 
-    RkSize increase_to_next {1ULL};
+    std::list<Range>::const_iterator const end_range = m_component_archetype.GetFreeEntitiesRanges().cend();
 
-    // If we need to take care of free entities and if we are on the border of a de-allocated entity range
-    if (m_next_empty_range != m_component_archetype.GetFreeEntitiesRanges().cend() && m_index == m_next_empty_range->begin)
-            increase_to_next = m_next_empty_range->size;
+    // Skipping every free range covering the next index, free ranges are sorted and never overlap
+    RkSize next_index = m_next_index;
+    for (; m_next_empty_range != end_range && m_next_empty_range->begin <= next_index; ++m_next_empty_range)
+        next_index = std::max(next_index, m_next_empty_range->begin + m_next_empty_range->size);
+
+    if (next_index >= m_component_archetype.GetCommittedRowsCount())
+        return false;
+
+    // Stores the increase required to reach the next entity
+    RkSize const increase_to_next = next_index - m_index;
 
     ([increase_to_next](ReferencePair<TFields>& in_pair)
     {
@@ -47,15 +53,16 @@ RkBool ComponentView<TPack<TIndices...>, TFields...>::FindNextEntity() noexcept
         RkSize const jumps = (in_pair.first + increase_to_next) / FieldChunk<TFields>::element_count;
 
         for(RkSize index = 0ULL; index < jumps; ++index)
-            in_pair.second = in_pair.second->next_node;
+            in_pair.second = in_pair.second->next_node.load(std::memory_order_acquire);
 
         in_pair.first = (in_pair.first + increase_to_next) % FieldChunk<TFields>::element_count;
 
     }(std::get<ReferencePair<TFields>>(m_fields_references)), ...);
 
-    m_index += increase_to_next;
+    m_index      = next_index;
+    m_next_index = next_index + 1ULL;
 
-    return m_index != m_component_archetype.GetEntitiesCount();
+    return true;
 }
 
 template <template <RkSize...> class TPack, RkSize... TIndices, ComponentFieldType... TFields>
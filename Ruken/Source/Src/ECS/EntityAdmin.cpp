@@ -22,8 +22,11 @@
  *  SOFTWARE.
  */
 
+#include "Build/Config.hpp"
+
 #include "ECS/EntityAdmin.hpp"
 #include "Core/ServiceProvider.hpp"
+#include "Debug/Tracing/TraceScope.hpp"
 
 USING_RUKEN_NAMESPACE
 
@@ -31,11 +34,80 @@ RkVoid EntityAdmin::BuildUpdatePlan() noexcept
 {
     m_update_plan.ResetPlan();
 
-    for (auto& system: m_systems)
+    for (RkSize index = 0ULL; index < m_systems.size(); ++index)
     {
-        m_update_plan.AddInstruction([&system] { system->OnUpdate(); });
+        // Disabled systems are simply not part of the plan
+        if (!m_update_mask[index])
+            continue;
+
+        // Systems without anything to update are skipped by the plan itself once their node is ready,
+        // without costing a job. This keeps the plan stable while entities come and go.
+        // System names are only used to trace the updates
+        m_update_plan.AddInstruction([system = m_systems[index].get()] {
+            system->OnUpdate();
+        }, m_systems_names[index], [](RkVoid* in_system) noexcept {
+            return !static_cast<SystemBase*>(in_system)->RequiresUpdate();
+        }, m_systems[index].get());
         m_update_plan.EndInstructionPack();
     }
+
+    m_update_plan_dirty = false;
+}
+
+RkVoid EntityAdmin::RefreshUpdatePlan() noexcept
+{
+    if (m_update_mask.size() != m_systems.size())
+    {
+        m_update_mask.resize(m_systems.size());
+        m_update_plan_dirty = true;
+    }
+
+    // Checking if any system has been enabled or disabled since the last build of the plan
+    for (RkSize index = 0ULL; index < m_systems.size(); ++index)
+    {
+        RkBool const enabled = m_systems[index]->enabled;
+
+        if (m_update_mask[index] != enabled)
+        {
+            m_update_mask[index] = enabled;
+            m_update_plan_dirty  = true;
+        }
+    }
+
+    if (m_update_plan_dirty)
+        BuildUpdatePlan();
+}
+
+RkVoid EntityAdmin::SetupArchetype(Archetype& in_archetype) noexcept
+{
+    for (std::unique_ptr<SystemBase>& system: m_systems)
+        if (system->GetQuery().Match(in_archetype))
+            system->AddReferenceGroup(in_archetype);
+
+    m_update_plan_dirty = true;
+}
+
+RkVoid EntityAdmin::SynchronizeArchetypes() noexcept
+{
+    RUKEN_TRACE_SCOPE("Synchronize archetypes", "ECS")
+
+    std::unique_lock<std::shared_mutex> lock(m_archetypes_mutex);
+
+    for (Archetype* archetype: m_pending_archetypes)
+        SetupArchetype(*archetype);
+
+    m_pending_archetypes.clear();
+
+    for (auto& [fingerprint, archetype]: m_archetypes)
+        archetype->CommitReservations();
+}
+
+RkVoid EntityAdmin::PublishExclusiveComponents() noexcept
+{
+    RUKEN_TRACE_SCOPE("Publish exclusive components", "ECS")
+
+    for (auto& [id, component]: m_exclusive_components)
+        component->Publish();
 }
 
 EntityAdmin::EntityAdmin(ServiceProvider& in_service_provider) noexcept:
@@ -45,6 +117,18 @@ EntityAdmin::EntityAdmin(ServiceProvider& in_service_provider) noexcept:
     // The entity admin requires a scheduler to be able to work
     if (!m_scheduler)
         SignalServiceInitializationFailure("The entity admin requires a scheduler to be able to work, updates are asynchronous");
+
+    #if defined(RUKEN_LOGGING_ENABLED)
+
+        if (Logger* root_logger = m_service_provider.LocateService<Logger>())
+            m_logger = root_logger->AddChild("ECS");
+
+    #endif
+}
+
+RkVoid EntityAdmin::InvalidateUpdatePlan() noexcept
+{
+    m_update_plan_dirty = true;
 }
 
 RkVoid EntityAdmin::StartSimulation() noexcept
@@ -52,11 +136,32 @@ RkVoid EntityAdmin::StartSimulation() noexcept
     // Simulation start is synchronous for now
     for (auto& system: m_systems)
         system->OnStart();
+
+    // Making the initial state of the exclusive components visible to the first update
+    PublishExclusiveComponents();
 }
 
 RkVoid EntityAdmin::UpdateSimulation() noexcept
 {
+    RUKEN_TRACE_SCOPE("Update simulation", "ECS")
+
+    // Archetypes created outside of an update still need to be setup
+    SynchronizeArchetypes();
+
+    // Rebuilding the plan if systems have been toggled or archetypes created
+    RefreshUpdatePlan();
+
     m_update_plan.ExecutePlanAsynchronously(*m_scheduler);
+
+    // End of frame synchronization point
+    SynchronizeArchetypes();
+    PublishExclusiveComponents();
+
+    if constexpr (RUKEN_ECS_STATISTICS_LOG_PERIOD > 0ULL)
+    {
+        if (++m_updates_count % RUKEN_ECS_STATISTICS_LOG_PERIOD == 0ULL)
+            LogStatisticsSummary();
+    }
 }
 
 RkVoid EntityAdmin::EndSimulation() noexcept
@@ -65,3 +170,54 @@ RkVoid EntityAdmin::EndSimulation() noexcept
     for (auto& system: m_systems)
         system->OnEnd();
 }
+
+std::vector<ArchetypeStatistics> EntityAdmin::GetArchetypesStatistics() noexcept
+{
+    std::shared_lock<std::shared_mutex> lock(m_archetypes_mutex);
+
+    std::vector<ArchetypeStatistics> statistics;
+    statistics.reserve(m_archetypes.size());
+
+    for (auto& [fingerprint, archetype]: m_archetypes)
+        statistics.emplace_back(archetype->GetStatistics());
+
+    return statistics;
+}
+
+RkVoid EntityAdmin::LogStatisticsSummary() noexcept
+{
+    if (!m_logger)
+        return;
+
+    std::vector<ArchetypeStatistics> const statistics = GetArchetypesStatistics();
+
+    ArchetypeStatistics total {};
+    for (ArchetypeStatistics const& archetype: statistics)
+    {
+        total.entities_count    += archetype.entities_count;
+        total.capacity          += archetype.capacity;
+        total.free_ranges_count += archetype.free_ranges_count;
+        total.allocated_bytes   += archetype.allocated_bytes;
+    }
+
+    if (total.capacity > 0ULL)
+        total.chunk_utilization = static_cast<RkFloat>(total.entities_count) / static_cast<RkFloat>(total.capacity);
+
+    m_logger->Info(std::to_string(statistics.size()) + " archetypes, "
+                 + std::to_string(total.entities_count) + " entities for a capacity of " + std::to_string(total.capacity)
+                 + " (" + std::to_string(static_cast<RkSize>(total.chunk_utilization * 100.0F)) + "% used), "
+                 + std::to_string(total.allocated_bytes / 1024ULL) + " KiB allocated, "
+                 + std::to_string(total.free_ranges_count) + " free ranges");
+
+    for (RkSize index = 0ULL; index < statistics.size(); ++index)
+    {
+        ArchetypeStatistics const& archetype = statistics[index];
+
+        m_logger->Debug("Archetype " + std::to_string(index) + " ("
+                      + std::to_string(archetype.components.size()) + " components): "
+                      + std::to_string(archetype.entities_count) + "/" + std::to_string(archetype.capacity) + " entities, "
+                      + std::to_string(archetype.allocated_bytes) + " bytes, "
+                      + std::to_string(archetype.free_ranges_count) + " free ranges ("
+                      + std::to_string(archetype.free_entities_count) + " free rows)");
+    }
+}
@@ -27,7 +27,10 @@ RkVoid EntityAdmin::CreateSystem() noexcept
 {
     std::unique_ptr<TSystem> system = std::make_unique<TSystem>(*this);
 
-    m_systems.emplace_back(std::move(system));
+    m_systems      .emplace_back(std::move(system));
+    m_systems_names.emplace_back(typeid(TSystem).name());
+
+    m_update_plan_dirty = true;
 }
 
 template <ComponentType... TComponents>
@@ -42,11 +45,6 @@ Archetype* EntityAdmin::CreateArchetype() noexcept
     Archetype* archetype_ptr = new_archetype.get();
     m_archetypes[targeted_fingerprint] = std::move(new_archetype);
 
-    // Setup
-    for (std::unique_ptr<SystemBase>& system: m_systems)
-        if (system->GetQuery().Match(*archetype_ptr))
-            system->AddReferenceGroup(*archetype_ptr);
-
     return archetype_ptr; 
 }
 
@@ -58,15 +56,56 @@ Entity EntityAdmin::CreateEntity() noexcept
 
     Archetype* target_archetype;
 
-    // If we didn't found any corresponding archetypes, creating it
-    if (m_archetypes.find(targeted_fingerprint) == m_archetypes.end())
-        target_archetype = CreateArchetype<TComponents...>();
-    else
-        target_archetype = m_archetypes[targeted_fingerprint].get();
+    {
+        std::unique_lock<std::shared_mutex> lock(m_archetypes_mutex);
+
+        // If we didn't found any corresponding archetypes, creating it
+        if (m_archetypes.find(targeted_fingerprint) == m_archetypes.end())
+        {
+            target_archetype = CreateArchetype<TComponents...>();
+            SetupArchetype(*target_archetype);
+        }
+        else
+            target_archetype = m_archetypes[targeted_fingerprint].get();
+    }
 
     return target_archetype->CreateEntity();
 }
 
+template <ComponentType... TComponents>
+Archetype& EntityAdmin::GetArchetype() noexcept
+{
+    ArchetypeFingerprint const targeted_fingerprint = ArchetypeFingerprint::CreateFingerPrintFrom<TComponents...>();
+
+    // Most of the time, the archetype already exists
+    {
+        std::shared_lock<std::shared_mutex> lock(m_archetypes_mutex);
+
+        auto const it = m_archetypes.find(targeted_fingerprint);
+        if (it != m_archetypes.end())
+            return *it->second;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_archetypes_mutex);
+
+    // Another thread might have created the archetype while we were waiting for the lock
+    auto const it = m_archetypes.find(targeted_fingerprint);
+    if (it != m_archetypes.end())
+        return *it->second;
+
+    // Systems might be iterating over their groups right now, the setup is deferred to the next synchronization point
+    Archetype* archetype = CreateArchetype<TComponents...>();
+    m_pending_archetypes.emplace_back(archetype);
+
+    return *archetype;
+}
+
+template <ComponentType... TComponents>
+Entity EntityAdmin::CreateEntityConcurrently() noexcept
+{
+    return GetArchetype<TComponents...>().CreateEntityConcurrently();
+}
+
 template <ExclusiveComponentType TComponent>
 TComponent& EntityAdmin::GetExclusiveComponent() noexcept
 {
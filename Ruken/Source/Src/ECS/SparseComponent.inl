@@ -33,6 +33,12 @@ RkSize SparseComponent<TMembers...>::EnsureStorageSpace(RkSize const in_size) no
     return Layout::EnsureStorageSpace(m_storage, in_size);
 }
 
+template <ComponentFieldType... TMembers>
+RkVoid SparseComponent<TMembers...>::CollectStatistics(ComponentStatistics& out_statistics) const noexcept
+{
+    Layout::CollectStatistics(m_storage, out_statistics);
+}
+
 template <ComponentFieldType... TMembers>
 template <ViewType TView>
 TView SparseComponent<TMembers...>::GetView() noexcept
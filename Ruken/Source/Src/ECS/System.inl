@@ -42,6 +42,29 @@ RkVoid System<TComponents...>::AddReferenceGroup(Archetype& in_archetype) noexce
     }(std::make_index_sequence<std::tuple_size_v<IterativeComponents>>());
 }
 
+template <ComponentType... TComponents>
+RkBool System<TComponents...>::RequiresUpdate() const noexcept
+{
+    if (!enabled)
+        return false;
+
+    // Systems working exclusively on exclusive components have to be updated every frame
+    if constexpr (std::tuple_size_v<IterativeComponents> == 0ULL)
+        return true;
+    else
+        return GetEntitiesCount() > 0ULL;
+}
+
+template <ComponentType... TComponents>
+RkSize System<TComponents...>::GetEntitiesCount() const noexcept
+{
+    RkSize count = 0ULL;
+    for (IterativeComponentsGroup const& group: m_groups)
+        count += group.GetReferencedArchetype().GetEntitiesCount();
+
+    return count;
+}
+
 template <ComponentType... TComponents>
 template <ExclusiveComponentType TExclusiveComponent>
 typename System<TComponents...>::template ExclusiveComponentAccess<TExclusiveComponent>& System<TComponents...>::GetExclusiveComponent() noexcept
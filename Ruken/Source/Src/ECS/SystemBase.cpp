@@ -31,6 +31,11 @@ ComponentQuery const& SystemBase::GetQuery() const noexcept
     return m_query;
 }
 
+RkBool SystemBase::RequiresUpdate() const noexcept
+{
+    return enabled;
+}
+
 RkVoid SystemBase::OnStart() noexcept
 {}
 
@@ -0,0 +1,191 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <string>
+
+#include "IO/File.hpp"
+
+#if defined(RUKEN_OS_WINDOWS)
+    #include "Utility/WindowsOS.hpp"
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/stat.h>
+#endif
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Constructors
+
+#if defined(RUKEN_OS_WINDOWS)
+
+File::File(std::string_view const in_path, RkBool const in_direct) noexcept:
+    m_handle {INVALID_HANDLE_VALUE}
+{
+    std::string const path(in_path);
+
+    // Positional reads are done through OVERLAPPED offsets on a synchronous handle
+    DWORD const flags = FILE_ATTRIBUTE_NORMAL | (in_direct ? FILE_FLAG_NO_BUFFERING : FILE_FLAG_SEQUENTIAL_SCAN);
+
+    m_handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+    m_direct = in_direct;
+
+    if (in_direct && m_handle == INVALID_HANDLE_VALUE)
+    {
+        m_handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        m_direct = false;
+    }
+
+    LARGE_INTEGER size {};
+    if (m_handle != INVALID_HANDLE_VALUE && GetFileSizeEx(m_handle, &size))
+        m_size = static_cast<RkUint64>(size.QuadPart);
+}
+
+File::~File() noexcept
+{
+    if (m_handle != INVALID_HANDLE_VALUE)
+        CloseHandle(m_handle);
+}
+
+#else
+
+File::File(std::string_view const in_path, RkBool const in_direct) noexcept:
+    m_handle {-1}
+{
+    std::string const path(in_path);
+
+    #if defined(O_DIRECT)
+
+        if (in_direct)
+        {
+            m_handle = open(path.c_str(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+            m_direct = m_handle >= 0;
+        }
+
+    #endif
+
+    // Some file systems (tmpfs for instance) do not support direct I/O
+    if (m_handle < 0)
+        m_handle = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    struct stat status {};
+    if (m_handle >= 0 && fstat(m_handle, &status) == 0)
+        m_size = static_cast<RkUint64>(status.st_size);
+}
+
+File::~File() noexcept
+{
+    if (m_handle >= 0)
+        close(m_handle);
+}
+
+#endif
+
+File::File(File&& in_move) noexcept:
+    m_handle {in_move.m_handle},
+    m_size   {in_move.m_size},
+    m_direct {in_move.m_direct}
+{
+    #if defined(RUKEN_OS_WINDOWS)
+        in_move.m_handle = INVALID_HANDLE_VALUE;
+    #else
+        in_move.m_handle = -1;
+    #endif
+}
+
+#pragma endregion
+
+#pragma region Methods
+
+RkBool File::IsValid() const noexcept
+{
+    #if defined(RUKEN_OS_WINDOWS)
+        return m_handle != INVALID_HANDLE_VALUE;
+    #else
+        return m_handle >= 0;
+    #endif
+}
+
+RkBool File::IsDirect() const noexcept
+{
+    return m_direct;
+}
+
+RkUint64 File::GetSize() const noexcept
+{
+    return m_size;
+}
+
+File::NativeHandle File::GetNativeHandle() const noexcept
+{
+    return m_handle;
+}
+
+RkInt64 File::ReadAt(RkUint64 const in_offset, RkVoid* out_buffer, RkSize const in_size) const noexcept
+{
+    #if defined(RUKEN_OS_WINDOWS)
+
+        OVERLAPPED overlapped {};
+        overlapped.Offset     = static_cast<DWORD>(in_offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(in_offset >> 32ULL);
+
+        DWORD read_bytes = 0U;
+        if (!ReadFile(m_handle, out_buffer, static_cast<DWORD>(in_size), &read_bytes, &overlapped))
+        {
+            DWORD const error = GetLastError();
+
+            // Reading past the end of the file is not an error
+            return error == ERROR_HANDLE_EOF ? 0LL : -static_cast<RkInt64>(error);
+        }
+
+        return static_cast<RkInt64>(read_bytes);
+
+    #else
+
+        RkSize read_bytes = 0ULL;
+
+        // pread can be interrupted or return less than asked before the end of the file
+        while (read_bytes < in_size)
+        {
+            ssize_t const result = pread(m_handle, static_cast<RkByte*>(out_buffer) + read_bytes, in_size - read_bytes, static_cast<off_t>(in_offset + read_bytes));
+
+            if (result < 0 && errno == EINTR)
+                continue;
+
+            if (result < 0)
+                return -static_cast<RkInt64>(errno);
+
+            if (result == 0)
+                break;
+
+            read_bytes += static_cast<RkSize>(result);
+        }
+
+        return static_cast<RkInt64>(read_bytes);
+
+    #endif
+}
+
+#pragma endregion
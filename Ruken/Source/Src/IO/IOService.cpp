@@ -0,0 +1,199 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <algorithm>
+
+#include "Build/Config.hpp"
+#include "Meta/Safety.hpp"
+
+#include "IO/IOService.hpp"
+#include "IO/IOUringBackend.hpp"
+#include "IO/IOThreadPoolBackend.hpp"
+
+#include "Core/ServiceProvider.hpp"
+#include "Threading/Scheduler.hpp"
+#include "Debug/Logging/Logger.hpp"
+#include "Debug/Tracing/TraceScope.hpp"
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Constructors
+
+IOService::IOService(ServiceProvider& in_service_provider) noexcept:
+    Service<IOService> {in_service_provider},
+    m_scheduler        {in_service_provider.LocateService<Scheduler>()}
+{
+    #if defined(RUKEN_LOGGING_ENABLED)
+
+        if (Logger* root_logger = m_service_provider.LocateService<Logger>())
+            m_logger = root_logger->AddChild("IO");
+
+    #endif
+
+    if (auto backend = std::make_unique<IOUringBackend>(*this, RUKEN_IO_QUEUE_DEPTH); backend->IsValid())
+        m_backend = std::move(backend);
+    else
+        m_backend = std::make_unique<IOThreadPoolBackend>(*this, RUKEN_IO_THREADS_COUNT);
+
+    RUKEN_SAFE_LOGGER_CALL(m_logger, Info(std::string("Reading files through the ") + m_backend->GetName() + " backend"))
+}
+
+IOService::~IOService() noexcept
+{
+    // Waits for every read in flight, completion jobs are still scheduled
+    m_backend.reset();
+}
+
+#pragma endregion
+
+#pragma region Methods
+
+RkVoid IOService::CompleteChunk(IOChunk& in_chunk, RkInt64 const in_result) noexcept
+{
+    IORequest* const request = in_chunk.request;
+
+    if (in_result < 0)
+    {
+        // Only the first error is reported
+        RkInt64 expected = 0LL;
+        request->error.compare_exchange_strong(expected, in_result, std::memory_order_relaxed);
+    }
+    else
+        request->read_bytes.fetch_add(in_result, std::memory_order_relaxed);
+
+    if (request->remaining_chunks.fetch_sub(1ULL, std::memory_order_acq_rel) != 1ULL)
+        return;
+
+    RUKEN_TRACE_INSTANT("Read complete", "IO")
+
+    RkInt64 const error  = request->error     .load(std::memory_order_relaxed);
+    RkInt64 const result = error != 0LL ? error : request->read_bytes.load(std::memory_order_relaxed);
+
+    m_pending_requests.fetch_sub(1ULL, std::memory_order_relaxed);
+
+    auto const complete = [request, result] {
+        request->callback(result);
+        delete request;
+    };
+
+    // Without a scheduler, the callback is invoked from the I/O thread itself
+    if (m_scheduler)
+        m_scheduler->ScheduleTask(complete, request->priority);
+    else
+        complete();
+}
+
+RkVoid IOService::Read(File const&        in_file,
+                       RkUint64     const in_offset,
+                       RkVoid*      const out_buffer,
+                       RkSize       const in_size,
+                       IOCallback&&       in_callback,
+                       EJobPriority const in_priority) noexcept
+{
+    IORequest* const request = new IORequest();
+
+    request->file     = &in_file;
+    request->callback = std::move(in_callback);
+    request->priority = in_priority;
+
+    // Empty reads still go through the backend, the callback is thus always invoked the same way
+    request->chunks_count = std::max<RkSize>((in_size + RUKEN_IO_MAX_CHUNK_SIZE - 1ULL) / RUKEN_IO_MAX_CHUNK_SIZE, 1ULL);
+    request->chunks       = std::make_unique<IOChunk[]>(request->chunks_count);
+    request->remaining_chunks.store(request->chunks_count, std::memory_order_relaxed);
+
+    for (RkSize index = 0ULL; index < request->chunks_count; ++index)
+    {
+        IOChunk& chunk = request->chunks[index];
+        RkSize const chunk_offset = index * RUKEN_IO_MAX_CHUNK_SIZE;
+
+        chunk.request = request;
+        chunk.offset  = in_offset + chunk_offset;
+        chunk.buffer  = static_cast<RkByte*>(out_buffer) + chunk_offset;
+        chunk.size    = std::min<RkSize>(in_size - std::min(in_size, chunk_offset), RUKEN_IO_MAX_CHUNK_SIZE);
+    }
+
+    m_pending_requests.fetch_add(1ULL, std::memory_order_relaxed);
+
+    m_backend->Submit(request->chunks.get(), request->chunks_count);
+}
+
+ReadAwaiter IOService::ReadAsync(File const&        in_file,
+                                 RkUint64     const in_offset,
+                                 RkVoid*      const out_buffer,
+                                 RkSize       const in_size,
+                                 EJobPriority const in_priority) noexcept
+{
+    return ReadAwaiter(*this, in_file, in_offset, out_buffer, in_size, in_priority);
+}
+
+RkVoid IOService::ReadFile(std::string_view const in_path,
+                           std::function<RkVoid(std::vector<RkByte>&&, RkInt64)>&& in_callback,
+                           EJobPriority const in_priority) noexcept
+{
+    // Owns the file and the content until the read is complete
+    struct FileRead
+    {
+        File                                                  file;
+        std::vector<RkByte>                                   content;
+        std::function<RkVoid(std::vector<RkByte>&&, RkInt64)> callback;
+    };
+
+    auto read = std::make_shared<FileRead>(File(in_path), std::vector<RkByte>(), std::move(in_callback));
+
+    if (!read->file.IsValid())
+    {
+        // Going through the scheduler anyway, the callback is never invoked from the calling thread
+        auto const fail = [read] { read->callback({}, -1LL); };
+
+        if (m_scheduler)
+            m_scheduler->ScheduleTask(fail, in_priority);
+        else
+            fail();
+
+        return;
+    }
+
+    read->content.resize(read->file.GetSize());
+
+    Read(read->file, 0ULL, read->content.data(), read->content.size(), [read](RkInt64 const in_result) {
+        if (in_result < 0LL)
+            read->content.clear();
+        else
+            read->content.resize(static_cast<RkSize>(in_result));
+
+        read->callback(std::move(read->content), in_result);
+    }, in_priority);
+}
+
+RkChar const* IOService::GetBackendName() const noexcept
+{
+    return m_backend->GetName();
+}
+
+RkSize IOService::GetPendingRequestsCount() const noexcept
+{
+    return m_pending_requests.load(std::memory_order_relaxed);
+}
+
+#pragma endregion
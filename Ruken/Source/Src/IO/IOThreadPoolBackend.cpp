@@ -0,0 +1,86 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <string>
+#include <algorithm>
+
+#include "IO/File.hpp"
+#include "IO/IOService.hpp"
+#include "IO/IORequest.hpp"
+#include "IO/IOThreadPoolBackend.hpp"
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Constructors
+
+IOThreadPoolBackend::IOThreadPoolBackend(IOService& in_service, RkSize const in_threads_count) noexcept:
+    m_service {in_service},
+    m_chunks  {},
+    m_threads (std::max<RkSize>(in_threads_count, 1ULL))
+{
+    for (RkSize index = 0ULL; index < m_threads.size(); ++index)
+    {
+        m_threads[index].Execute(&IOThreadPoolBackend::ThreadJob, this);
+        m_threads[index].SetName("Ruken IO " + std::to_string(index));
+    }
+}
+
+IOThreadPoolBackend::~IOThreadPoolBackend() noexcept
+{
+    // Chunks are read in order, every chunk submitted before the stop requests is thus still completed
+    for (RkSize index = 0ULL; index < m_threads.size(); ++index)
+        m_chunks.Enqueue(nullptr);
+
+    for (Worker& thread: m_threads)
+        thread.WaitForAvailability();
+}
+
+#pragma endregion
+
+#pragma region Methods
+
+RkVoid IOThreadPoolBackend::ThreadJob() noexcept
+{
+    IOChunk* chunk = nullptr;
+
+    while (m_chunks.Dequeue(chunk) && chunk)
+    {
+        RkInt64 const result = chunk->request->file->ReadAt(chunk->offset, chunk->buffer, chunk->size);
+
+        m_service.CompleteChunk(*chunk, result);
+    }
+}
+
+RkVoid IOThreadPoolBackend::Submit(IOChunk* in_chunks, RkSize const in_count) noexcept
+{
+    for (RkSize index = 0ULL; index < in_count; ++index)
+        m_chunks.Enqueue(in_chunks + index);
+}
+
+RkChar const* IOThreadPoolBackend::GetName() const noexcept
+{
+    return "thread pool";
+}
+
+#pragma endregion
@@ -0,0 +1,326 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+
+#include "IO/File.hpp"
+#include "IO/IOService.hpp"
+#include "IO/IORequest.hpp"
+#include "IO/IOUringBackend.hpp"
+
+#if defined(RUKEN_OS_LINUX)
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/eventfd.h>
+    #include <sys/syscall.h>
+    #include <linux/io_uring.h>
+#endif
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Constructors
+
+IOUringBackend::IOUringBackend(IOService& in_service, RkUint32 const in_queue_depth) noexcept:
+    m_service {in_service}
+{
+    #if defined(RUKEN_OS_LINUX)
+
+        m_wake_fd = eventfd(0U, EFD_CLOEXEC);
+
+        if (m_wake_fd < 0 || !SetupRing(in_queue_depth))
+            return;
+
+        m_running.store(true, std::memory_order_release);
+
+        m_thread.Execute(&IOUringBackend::ThreadJob, this);
+        m_thread.SetName("Ruken IO");
+
+    #else
+
+        (RkVoid)in_queue_depth;
+
+    #endif
+}
+
+IOUringBackend::~IOUringBackend() noexcept
+{
+    #if defined(RUKEN_OS_LINUX)
+
+        // The I/O thread completes every chunk in flight before leaving
+        if (m_running.exchange(false, std::memory_order_acq_rel))
+        {
+            WakeUp();
+            m_thread.WaitForAvailability();
+        }
+
+        if (m_sqes)
+            munmap(m_sqes, m_sqes_size);
+
+        if (m_cq_ring && m_cq_ring != m_sq_ring)
+            munmap(m_cq_ring, m_cq_ring_size);
+
+        if (m_sq_ring)
+            munmap(m_sq_ring, m_sq_ring_size);
+
+        if (m_ring_fd >= 0)
+            close(m_ring_fd);
+
+        if (m_wake_fd >= 0)
+            close(m_wake_fd);
+
+    #endif
+}
+
+#pragma endregion
+
+#pragma region Methods
+
+#if defined(RUKEN_OS_LINUX)
+
+RkBool IOUringBackend::SetupRing(RkUint32 const in_entries) noexcept
+{
+    io_uring_params params {};
+
+    m_ring_fd = static_cast<RkInt>(syscall(__NR_io_uring_setup, in_entries, &params));
+    if (m_ring_fd < 0)
+        return false;
+
+    // IORING_OP_READ came along with this feature (Linux 5.6)
+    if (!(params.features & IORING_FEAT_RW_CUR_POS))
+        return false;
+
+    m_sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(RkUint32);
+    m_cq_ring_size = params.cq_off.cqes  + params.cq_entries * sizeof(io_uring_cqe);
+    m_sqes_size    = params.sq_entries * sizeof(io_uring_sqe);
+
+    // Both rings can share the same mapping since Linux 5.4
+    RkBool const single_mapping = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mapping)
+        m_sq_ring_size = m_cq_ring_size = std::max(m_sq_ring_size, m_cq_ring_size);
+
+    auto const map = [this](RkSize const in_size, off_t const in_offset) -> RkVoid* {
+        RkVoid* const address = mmap(nullptr, in_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring_fd, in_offset);
+
+        return address == MAP_FAILED ? nullptr : address;
+    };
+
+    m_sq_ring = map(m_sq_ring_size, IORING_OFF_SQ_RING);
+    m_cq_ring = single_mapping ? m_sq_ring : map(m_cq_ring_size, IORING_OFF_CQ_RING);
+    m_sqes    = map(m_sqes_size, IORING_OFF_SQES);
+
+    if (!m_sq_ring || !m_cq_ring || !m_sqes)
+        return false;
+
+    RkByte* const sq_ring = static_cast<RkByte*>(m_sq_ring);
+    RkByte* const cq_ring = static_cast<RkByte*>(m_cq_ring);
+
+    m_sq_head    = reinterpret_cast<RkUint32*>(sq_ring + params.sq_off.head);
+    m_sq_tail    = reinterpret_cast<RkUint32*>(sq_ring + params.sq_off.tail);
+    m_sq_array   = reinterpret_cast<RkUint32*>(sq_ring + params.sq_off.array);
+    m_sq_mask    = *reinterpret_cast<RkUint32*>(sq_ring + params.sq_off.ring_mask);
+    m_sq_entries = params.sq_entries;
+
+    m_cq_head = reinterpret_cast<RkUint32*>(cq_ring + params.cq_off.head);
+    m_cq_tail = reinterpret_cast<RkUint32*>(cq_ring + params.cq_off.tail);
+    m_cq_mask = *reinterpret_cast<RkUint32*>(cq_ring + params.cq_off.ring_mask);
+    m_cqes    = cq_ring + params.cq_off.cqes;
+
+    return true;
+}
+
+RkVoid IOUringBackend::PrepareRead(IOChunk* in_chunk) noexcept
+{
+    // The I/O thread is the only one writing the tail
+    RkUint32 const tail  = *m_sq_tail;
+    RkUint32 const index = tail & m_sq_mask;
+
+    io_uring_sqe& entry = static_cast<io_uring_sqe*>(m_sqes)[index];
+    std::memset(&entry, 0, sizeof(io_uring_sqe));
+
+    entry.opcode    = IORING_OP_READ;
+    entry.user_data = reinterpret_cast<RkUint64>(in_chunk);
+
+    if (in_chunk)
+    {
+        // Resuming after the bytes already read, in case of a short read
+        entry.fd   = in_chunk->request->file->GetNativeHandle();
+        entry.addr = reinterpret_cast<RkUint64>(in_chunk->buffer + in_chunk->read_bytes);
+        entry.len  = static_cast<RkUint32>(in_chunk->size - in_chunk->read_bytes);
+        entry.off  = in_chunk->offset + in_chunk->read_bytes;
+    }
+    else
+    {
+        entry.fd   = m_wake_fd;
+        entry.addr = reinterpret_cast<RkUint64>(&m_wake_counter);
+        entry.len  = sizeof(RkUint64);
+    }
+
+    m_sq_array[index] = index;
+
+    // Publishing the entry to the kernel
+    std::atomic_ref<RkUint32>(*m_sq_tail).store(tail + 1U, std::memory_order_release);
+}
+
+RkVoid IOUringBackend::ThreadJob() noexcept
+{
+    // Chunks waiting for some room in the ring
+    std::vector<IOChunk*> backlog;
+    RkSize                backlog_head = 0ULL;
+
+    // One entry is always left to the wake up read
+    RkUint32 const max_in_flight = m_sq_entries - 1U;
+    RkUint32       in_flight     = 0U;
+    RkUint32       to_submit     = 0U;
+
+    PrepareRead(nullptr);
+    ++to_submit;
+
+    for (;;)
+    {
+        // Loaded before picking up the pending chunks: once stopped, no chunk can be submitted anymore
+        RkBool const running = m_running.load(std::memory_order_acquire);
+
+        {
+            std::lock_guard lock(m_pending_mutex);
+
+            backlog.insert(backlog.end(), m_pending.begin(), m_pending.end());
+            m_pending.clear();
+        }
+
+        for (; backlog_head < backlog.size() && in_flight < max_in_flight; ++in_flight, ++to_submit)
+            PrepareRead(backlog[backlog_head++]);
+
+        if (backlog_head == backlog.size())
+        {
+            backlog.clear();
+            backlog_head = 0ULL;
+        }
+
+        if (!running && in_flight == 0U && backlog.empty())
+            break;
+
+        // Submitting the whole batch and waiting for at least one completion with a single system call
+        RkInt64 const submitted = syscall(__NR_io_uring_enter, m_ring_fd, to_submit, 1U, IORING_ENTER_GETEVENTS, nullptr, 0ULL);
+        if (submitted > 0)
+            to_submit -= static_cast<RkUint32>(submitted);
+
+        // The I/O thread is the only one writing the head
+        RkUint32       head = *m_cq_head;
+        RkUint32 const tail = std::atomic_ref<RkUint32>(*m_cq_tail).load(std::memory_order_acquire);
+
+        for (; head != tail; ++head)
+        {
+            io_uring_cqe const& completion = static_cast<io_uring_cqe*>(m_cqes)[head & m_cq_mask];
+            IOChunk*      const chunk      = reinterpret_cast<IOChunk*>(completion.user_data);
+
+            // Someone submitted new chunks, re-arming the wake up read
+            if (!chunk)
+            {
+                PrepareRead(nullptr);
+                ++to_submit;
+                continue;
+            }
+
+            --in_flight;
+
+            if (completion.res == -EINTR || completion.res == -EAGAIN)
+            {
+                backlog.push_back(chunk);
+                continue;
+            }
+
+            if (completion.res < 0)
+            {
+                m_service.CompleteChunk(*chunk, completion.res);
+                continue;
+            }
+
+            chunk->read_bytes += static_cast<RkSize>(completion.res);
+
+            // Short read before the end of the file, reading the rest
+            if (completion.res > 0 && chunk->read_bytes < chunk->size && chunk->offset + chunk->read_bytes < chunk->request->file->GetSize())
+            {
+                backlog.push_back(chunk);
+                continue;
+            }
+
+            m_service.CompleteChunk(*chunk, static_cast<RkInt64>(chunk->read_bytes));
+        }
+
+        std::atomic_ref<RkUint32>(*m_cq_head).store(head, std::memory_order_release);
+    }
+}
+
+RkVoid IOUringBackend::WakeUp() const noexcept
+{
+    eventfd_write(m_wake_fd, 1ULL);
+}
+
+#else
+
+RkBool IOUringBackend::SetupRing(RkUint32 const in_entries) noexcept
+{
+    (RkVoid)in_entries;
+
+    return false;
+}
+
+RkVoid IOUringBackend::PrepareRead(IOChunk* in_chunk) noexcept
+{
+    (RkVoid)in_chunk;
+}
+
+RkVoid IOUringBackend::ThreadJob() noexcept
+{}
+
+RkVoid IOUringBackend::WakeUp() const noexcept
+{}
+
+#endif
+
+RkBool IOUringBackend::IsValid() const noexcept
+{
+    return m_running.load(std::memory_order_acquire);
+}
+
+RkVoid IOUringBackend::Submit(IOChunk* in_chunks, RkSize const in_count) noexcept
+{
+    {
+        std::lock_guard lock(m_pending_mutex);
+
+        for (RkSize index = 0ULL; index < in_count; ++index)
+            m_pending.push_back(in_chunks + index);
+    }
+
+    WakeUp();
+}
+
+RkChar const* IOUringBackend::GetName() const noexcept
+{
+    return "io_uring";
+}
+
+#pragma endregion
@@ -0,0 +1,61 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include "IO/IOService.hpp"
+#include "IO/ReadAwaiter.hpp"
+
+USING_RUKEN_NAMESPACE
+
+ReadAwaiter::ReadAwaiter(IOService&         in_service,
+                         File const&        in_file,
+                         RkUint64     const in_offset,
+                         RkVoid*      const in_buffer,
+                         RkSize       const in_size,
+                         EJobPriority const in_priority) noexcept:
+    m_service  {in_service},
+    m_file     {in_file},
+    m_offset   {in_offset},
+    m_buffer   {in_buffer},
+    m_size     {in_size},
+    m_priority {in_priority}
+{}
+
+RkBool ReadAwaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+RkVoid ReadAwaiter::await_suspend(std::coroutine_handle<> in_handle) noexcept
+{
+    // The awaiter lives in the frame of the suspended coroutine until it is resumed
+    m_service.Read(m_file, m_offset, m_buffer, m_size, [this, in_handle](RkInt64 const in_result) {
+        m_result = in_result;
+        in_handle.resume();
+    }, m_priority);
+}
+
+RkInt64 ReadAwaiter::await_resume() const noexcept
+{
+    return m_result;
+}
@@ -22,12 +22,18 @@
  *  SOFTWARE.
  */
 
+#include <cstring>
+
 #include "Core/Kernel.hpp"
+#include "Utility/BenchmarkSuite.hpp"
 
 USING_RUKEN_NAMESPACE
 
-int main()
+int main(int argc, char** argv)
 {
+    if (argc > 1 && std::strcmp(argv[1], "--benchmarks") == 0)
+        return RunBenchmarks();
+
     Kernel kernel;
 
     return kernel.Run();
@@ -0,0 +1,63 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include "Memory/FrameAllocator.hpp"
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Methods
+
+RkVoid FrameAllocator::NextFrame() noexcept
+{
+    m_frame_index.fetch_add(1ULL, std::memory_order_release);
+
+    SynchronizeThread();
+}
+
+RkVoid FrameAllocator::SynchronizeThread() noexcept
+{
+    RkUint64 const frame_index = m_frame_index.load(std::memory_order_acquire);
+    if (m_thread_frame_index != frame_index)
+    {
+        m_thread_allocator.Reset();
+        m_thread_frame_index = frame_index;
+    }
+}
+
+RkUint64 FrameAllocator::GetFrameIndex() noexcept
+{
+    return m_frame_index.load(std::memory_order_acquire);
+}
+
+LinearAllocator& FrameAllocator::GetAllocator() noexcept
+{
+    return m_thread_allocator;
+}
+
+std::pmr::memory_resource* FrameAllocator::GetResource() noexcept
+{
+    return &m_thread_resource;
+}
+
+#pragma endregion
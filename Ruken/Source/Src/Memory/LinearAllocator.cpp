@@ -0,0 +1,117 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <algorithm>
+
+#include "Memory/LinearAllocator.hpp"
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Constructors
+
+LinearAllocator::LinearAllocator(RkSize const in_capacity) noexcept
+{
+    if (in_capacity > 0ULL)
+        AddChunk(in_capacity);
+}
+
+#pragma endregion
+
+#pragma region Methods
+
+RkVoid LinearAllocator::AddChunk(RkSize const in_size) noexcept
+{
+    m_chunks.push_back({std::make_unique<RkByte[]>(in_size), in_size});
+    m_offset = 0ULL;
+}
+
+RkVoid* LinearAllocator::Allocate(RkSize const in_size, RkSize const in_alignment) noexcept
+{
+    m_allocated += in_size;
+    m_peak       = std::max(m_peak, m_allocated);
+
+    if (!m_chunks.empty())
+    {
+        Chunk& chunk = m_chunks.back();
+
+        // Aligning the current position of the chunk
+        RkSize const address = reinterpret_cast<RkSize>(chunk.data.get()) + m_offset;
+        RkSize const padding = (in_alignment - address % in_alignment) % in_alignment;
+
+        if (m_offset + padding + in_size <= chunk.size)
+        {
+            m_offset += padding + in_size;
+
+            return chunk.data.get() + m_offset - in_size;
+        }
+    }
+
+    // The current chunk is exhausted, the next one is at least twice as big to limit the number of chunks.
+    // The alignment is added to the size to make sure the block fits whatever the alignment of the chunk is
+    RkSize const last_size = m_chunks.empty() ? 0ULL : m_chunks.back().size;
+    AddChunk(std::max<RkSize>(last_size * 2ULL, in_size + in_alignment));
+
+    RkSize const address = reinterpret_cast<RkSize>(m_chunks.back().data.get());
+    RkSize const padding = (in_alignment - address % in_alignment) % in_alignment;
+
+    m_offset = padding + in_size;
+
+    return m_chunks.back().data.get() + padding;
+}
+
+RkVoid LinearAllocator::Reset() noexcept
+{
+    // Coalescing the chunks into a single one, this way the next cycles won't need to allocate anything
+    if (m_chunks.size() > 1ULL)
+    {
+        RkSize const capacity = GetCapacity();
+
+        m_chunks.clear();
+        AddChunk(capacity);
+    }
+
+    m_offset    = 0ULL;
+    m_allocated = 0ULL;
+}
+
+RkSize LinearAllocator::GetCapacity() const noexcept
+{
+    RkSize capacity = 0ULL;
+    for (Chunk const& chunk: m_chunks)
+        capacity += chunk.size;
+
+    return capacity;
+}
+
+RkSize LinearAllocator::GetAllocatedSize() const noexcept
+{
+    return m_allocated;
+}
+
+RkSize LinearAllocator::GetPeakSize() const noexcept
+{
+    return m_peak;
+}
+
+#pragma endregion
@@ -0,0 +1,62 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include "Memory/LinearMemoryResource.hpp"
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Constructors
+
+LinearMemoryResource::LinearMemoryResource(LinearAllocator& in_allocator) noexcept:
+    m_allocator {in_allocator}
+{ }
+
+#pragma endregion
+
+#pragma region Methods
+
+RkVoid* LinearMemoryResource::do_allocate(RkSize const in_bytes, RkSize const in_alignment)
+{
+    return m_allocator.Allocate(in_bytes, in_alignment);
+}
+
+RkVoid LinearMemoryResource::do_deallocate(RkVoid* in_pointer, RkSize const in_bytes, RkSize const in_alignment)
+{
+    // Linear allocations are only released all at once
+    (RkVoid)in_pointer;
+    (RkVoid)in_bytes;
+    (RkVoid)in_alignment;
+}
+
+RkBool LinearMemoryResource::do_is_equal(std::pmr::memory_resource const& in_other) const noexcept
+{
+    return this == &in_other;
+}
+
+LinearAllocator& LinearMemoryResource::GetAllocator() const noexcept
+{
+    return m_allocator;
+}
+
+#pragma endregion
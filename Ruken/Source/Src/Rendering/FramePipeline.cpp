@@ -0,0 +1,148 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <algorithm>
+
+#include "Rendering/FramePipeline.hpp"
+
+#include "Threading/Scheduler.hpp"
+#include "Debug/Tracing/TraceScope.hpp"
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Constructors
+
+FramePipeline::FramePipeline(Scheduler& in_scheduler, RenderCallback&& in_render_callback, RkUint32 const in_depth) noexcept:
+    m_scheduler       {in_scheduler},
+    m_depth           {std::max(in_depth, 1U)},
+    m_snapshots       {std::make_unique<RenderSnapshot[]>(m_depth)},
+    m_render_callback {std::move(in_render_callback)}
+{ }
+
+FramePipeline::~FramePipeline() noexcept
+{
+    Flush();
+}
+
+#pragma endregion
+
+#pragma region Methods
+
+RkVoid FramePipeline::RenderDriver() noexcept
+{
+    RkUint64 rendered_frames = m_rendered_frames.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        while (rendered_frames < m_extracted_frames.load(std::memory_order_acquire))
+        {
+            {
+                RUKEN_TRACE_SCOPE("Render frame", "Rendering")
+
+                m_render_callback(m_snapshots[rendered_frames % m_depth]);
+            }
+
+            // Releasing the snapshot to the submitting thread
+            m_rendered_frames.store(++rendered_frames, std::memory_order_release);
+            m_rendered_frames.notify_all();
+        }
+
+        // Giving up the driver role, then checking for a frame submitted in the meantime.
+        // Both sides use sequentially consistent operations, either the submitting thread sees the driver as inactive
+        // and schedules a new driver, or the driver sees the new frame and takes the role back.
+        m_render_active.store(false, std::memory_order_seq_cst);
+
+        if (m_extracted_frames.load(std::memory_order_seq_cst) == rendered_frames ||
+            m_render_active.exchange(true, std::memory_order_seq_cst))
+            return;
+    }
+}
+
+RkVoid FramePipeline::WaitForRenderedFrames(RkUint64 const in_frames_count) noexcept
+{
+    RkUint64 rendered_frames = m_rendered_frames.load(std::memory_order_acquire);
+
+    if (rendered_frames >= in_frames_count)
+        return;
+
+    RUKEN_TRACE_SCOPE("Wait for render", "Rendering")
+
+    while (rendered_frames < in_frames_count)
+    {
+        // The driver job might still be pending, in which case we execute it ourselves
+        if (!m_scheduler.TryExecuteJob())
+            m_rendered_frames.wait(rendered_frames, std::memory_order_acquire);
+
+        rendered_frames = m_rendered_frames.load(std::memory_order_acquire);
+    }
+}
+
+RkVoid FramePipeline::SubmitFrame(RkFloat const in_interpolation_alpha) noexcept
+{
+    RkUint64 const frame_index = m_extracted_frames.load(std::memory_order_relaxed);
+
+    // The snapshot of this frame is no longer in use by the rendering, see the wait below
+    {
+        RUKEN_TRACE_SCOPE("Extract frame", "Rendering")
+
+        RenderSnapshot& snapshot = m_snapshots[frame_index % m_depth];
+
+        snapshot.Reset(frame_index, in_interpolation_alpha);
+        on_extract.Invoke(snapshot);
+    }
+
+    m_extracted_frames.store(frame_index + 1ULL, std::memory_order_seq_cst);
+
+    if (!m_render_active.exchange(true, std::memory_order_seq_cst))
+        m_scheduler.ScheduleTask([this] { RenderDriver(); }, m_driver_token);
+
+    // Leaving room for the next frame, at most depth - 1 frames can be in flight while the next one is being simulated
+    if (frame_index + 2ULL > m_depth)
+        WaitForRenderedFrames(frame_index + 2ULL - m_depth);
+}
+
+RkVoid FramePipeline::Flush() noexcept
+{
+    WaitForRenderedFrames(m_extracted_frames.load(std::memory_order_relaxed));
+
+    // The driver might still be finishing up after its last frame
+    m_scheduler.Wait(m_driver_token);
+}
+
+RkUint32 FramePipeline::GetDepth() const noexcept
+{
+    return m_depth;
+}
+
+RkUint64 FramePipeline::GetSubmittedFramesCount() const noexcept
+{
+    return m_extracted_frames.load(std::memory_order_acquire);
+}
+
+RkUint64 FramePipeline::GetRenderedFramesCount() const noexcept
+{
+    return m_rendered_frames.load(std::memory_order_acquire);
+}
+
+#pragma endregion
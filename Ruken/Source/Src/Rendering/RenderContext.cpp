@@ -51,7 +51,7 @@ RkBool RenderContext::BeginFrame() noexcept
     if (m_is_frame_active)
         return false;
 
-    m_frame_index = m_frame_index + 1 % m_render_frames.size();
+    m_frame_index = (m_frame_index + 1) % m_render_frames.size();
 
     auto& active_frame = m_render_frames[m_frame_index];
 
@@ -57,6 +57,10 @@ RenderFrame::RenderFrame(RenderFrame&& in_move) noexcept:
 
 RkBool RenderFrame::Reset() noexcept
 {
+    // The frame might still be in use by the device, its resources can only be recycled once its fences are signaled
+    if (!m_fence_pool->Wait())
+        return false;
+
     m_render_views.clear();
 
     if (m_fence_pool           ->Reset() &&
@@ -0,0 +1,80 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include "Build/Config.hpp"
+
+#include "Rendering/RenderSnapshot.hpp"
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Constructors
+
+RenderSnapshot::RenderSnapshot() noexcept:
+    m_allocator       {RUKEN_RENDER_SNAPSHOT_CAPACITY},
+    m_memory_resource {m_allocator}
+{ }
+
+RenderSnapshot::~RenderSnapshot() noexcept
+{
+    Clear();
+}
+
+#pragma endregion
+
+#pragma region Methods
+
+RkVoid RenderSnapshot::Clear() noexcept
+{
+    // Destroying in reverse order, later data might refer to earlier data
+    for (auto entry = m_entries.rbegin(); entry != m_entries.rend(); ++entry)
+        entry->destroy(entry->data);
+
+    m_entries.clear();
+    m_allocator.Reset();
+}
+
+RkVoid RenderSnapshot::Reset(RkUint64 const in_frame_index, RkFloat const in_interpolation_alpha) noexcept
+{
+    Clear();
+
+    m_frame_index         = in_frame_index;
+    m_interpolation_alpha = in_interpolation_alpha;
+}
+
+RkUint64 RenderSnapshot::GetFrameIndex() const noexcept
+{
+    return m_frame_index;
+}
+
+RkFloat RenderSnapshot::GetInterpolationAlpha() const noexcept
+{
+    return m_interpolation_alpha;
+}
+
+std::pmr::memory_resource* RenderSnapshot::GetMemoryResource() noexcept
+{
+    return &m_memory_resource;
+}
+
+#pragma endregion
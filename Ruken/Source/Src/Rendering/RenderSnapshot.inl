@@ -0,0 +1,50 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+template <typename TData, typename... TArgs>
+TData& RenderSnapshot::Emplace(TArgs&&... in_args) noexcept
+{
+    TData* data = static_cast<TData*>(m_allocator.Allocate(sizeof(TData), alignof(TData)));
+    std::construct_at(data, std::forward<TArgs>(in_args)...);
+
+    m_entries.push_back({typeid(TData).hash_code(), data, [](RkVoid* in_data) {
+        std::destroy_at(static_cast<TData*>(in_data));
+    }});
+
+    return *data;
+}
+
+template <typename TData>
+TData const* RenderSnapshot::Find() const noexcept
+{
+    RkSize const type = typeid(TData).hash_code();
+
+    for (Entry const& entry: m_entries)
+    {
+        if (entry.type == type)
+            return static_cast<TData const*>(entry.data);
+    }
+
+    return nullptr;
+}
@@ -68,6 +68,11 @@ Renderer::Renderer(ServiceProvider& in_service_provider) noexcept:
             MakeContext(in_window);
         };
 
+        m_frame_pipeline = std::make_unique<FramePipeline>(*m_scheduler, [this](RenderSnapshot const& in_snapshot)
+        {
+            Render(in_snapshot);
+        });
+
         if (m_logger)
             m_logger->Info("Renderer initialized.");
     }
@@ -78,6 +83,9 @@ Renderer::Renderer(ServiceProvider& in_service_provider) noexcept:
 
 Renderer::~Renderer() noexcept
 {
+    // Frames in flight must be done before destroying anything they use
+    m_frame_pipeline.reset();
+
     if (m_device)
         m_device->WaitIdle();
 
@@ -97,9 +105,25 @@ Renderer::~Renderer() noexcept
 
 RkVoid Renderer::MakeContext(Window& in_window) noexcept
 {
+    // The contexts are used by the frames in flight
+    if (m_frame_pipeline)
+        m_frame_pipeline->Flush();
+
     m_render_contexts.emplace_back(*this, *m_scheduler, in_window);
 }
 
+RkVoid Renderer::Render(RenderSnapshot const& in_snapshot) noexcept
+{
+    // Nothing is drawn from the snapshot yet, every context simply presents its next frame
+    (RkVoid)in_snapshot;
+
+    for (RenderContext& render_context: m_render_contexts)
+    {
+        if (render_context.BeginFrame())
+            render_context.EndFrame();
+    }
+}
+
 VulkanInstance& Renderer::GetInstance() const noexcept
 {
     return *m_instance;
@@ -120,4 +144,9 @@ VulkanDeviceAllocator& Renderer::GetDeviceAllocator() const noexcept
     return *m_device_allocator;
 }
 
+FramePipeline* Renderer::GetFramePipeline() const noexcept
+{
+    return m_frame_pipeline.get();
+}
+
 #pragma endregion
\ No newline at end of file
@@ -114,14 +114,21 @@ RkBool Handle<TResource_Type>::WaitForValidity(RkFloat in_timeout) const noexcep
     if (!m_manifest)
         return false;
 
-    TODO("Jul 23 2019", "Implement the handle timeout");
-    while (!Available())
+    auto const deadline = in_timeout < 0.0F ? std::chrono::steady_clock::time_point::max() :
+                          std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<RkFloat>(in_timeout));
+
+    for (EResourceStatus status = m_manifest->status.load(std::memory_order_acquire); status != EResourceStatus::Loaded;
+                         status = m_manifest->status.load(std::memory_order_acquire))
     {
         // If something wrong happened, then stopping the wait here and notifying the user
-        if (m_manifest->status.load(std::memory_order_acquire) == EResourceStatus::Invalid)
+        if (status == EResourceStatus::Invalid)
             return false;
 
-        std::this_thread::yield();
+        // Sleeping until the status changes, see ResourceManager::NotifyStatusChange()
+        RUKEN_TRACE_SCOPE("Wait for resource", "Resource")
+
+        if (!Futex::WaitUntil(m_manifest->status, status, deadline))
+            return m_manifest->status.load(std::memory_order_acquire) == EResourceStatus::Loaded;
     }
 
     return true;
@@ -194,4 +201,10 @@ Handle<TResource_Type>::operator Handle<TDerived>() const
 {
     static_assert(std::is_base_of<TDerived, TResource_Type>::value);
     return Handle<TDerived>(m_manifest);
-}
\ No newline at end of file
+}
+
+template <typename TResource_Type>
+ResourceAwaiter Handle<TResource_Type>::operator co_await() const noexcept
+{
+    return ResourceAwaiter(m_manifest);
+}
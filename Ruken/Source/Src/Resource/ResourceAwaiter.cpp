@@ -0,0 +1,62 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include "Resource/ResourceAwaiter.hpp"
+#include "Resource/ResourceManifest.hpp"
+
+USING_RUKEN_NAMESPACE
+
+ResourceAwaiter::ResourceAwaiter(ResourceManifest* in_manifest) noexcept:
+    m_manifest {in_manifest}
+{}
+
+RkBool ResourceAwaiter::IsSettled(EResourceStatus const in_status) noexcept
+{
+    // Loaded and Invalid are the only states a resource can stay in
+    return in_status == EResourceStatus::Loaded || in_status == EResourceStatus::Invalid;
+}
+
+RkBool ResourceAwaiter::await_ready() const noexcept
+{
+    return !m_manifest || IsSettled(m_manifest->status.load(std::memory_order_acquire));
+}
+
+RkBool ResourceAwaiter::await_suspend(std::coroutine_handle<> const in_handle) const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_manifest->waiters_mutex);
+
+    // The status is always updated before the waiters get notified (under this lock),
+    // so either we see the new status here, or the notification will see us
+    if (IsSettled(m_manifest->status.load(std::memory_order_acquire)))
+        return false;
+
+    m_manifest->waiters.emplace_back(in_handle);
+
+    return true;
+}
+
+RkBool ResourceAwaiter::await_resume() const noexcept
+{
+    return m_manifest && m_manifest->status.load(std::memory_order_acquire) == EResourceStatus::Loaded;
+}
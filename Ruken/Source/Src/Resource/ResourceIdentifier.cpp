@@ -22,44 +22,132 @@
  *  SOFTWARE.
  */
 
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <unordered_map>
+
+#include "Build/Config.hpp"
+#include "Meta/Safety.hpp"
+
+#include "Debug/Logging/Logger.hpp"
+
+#include "Threading/Synchronized.hpp"
+#include "Threading/SynchronizedAccess.hpp"
+
 #include "Resource/ResourceIdentifier.hpp"
 
 USING_RUKEN_NAMESPACE
 
-ResourceIdentifier::ResourceIdentifier(std::string const& in_name) noexcept:
-    name {in_name}
-{}
+// Logger the collisions are reported to, constant initialized to be usable during static initialization
+static std::atomic<Logger*> collisions_logger {nullptr};
+
+#ifdef RUKEN_RESOURCE_IDENTIFIER_INTERNING
 
-ResourceIdentifier::ResourceIdentifier(ResourceIdentifier const& in_copy) noexcept
+/**
+ * \brief Reports a hash collision between two paths
+ * \param in_interned_name Path already interned
+ * \param in_name Colliding path
+ */
+static RkVoid ReportCollision(std::string_view const in_interned_name, std::string_view const in_name) noexcept
 {
-    name = in_copy.name;
+    [[maybe_unused]] Logger* const logger = collisions_logger.load(std::memory_order_acquire);
+
+    RUKEN_SAFE_LOGGER_CALL(logger, Warning("Resource identifier collision between " + std::string(in_interned_name) + " and " + std::string(in_name)))
 }
 
-ResourceIdentifier::ResourceIdentifier(ResourceIdentifier&& in_move) noexcept
+using InternedNames = Synchronized<std::unordered_map<RkUint64, std::string>>;
+
+/**
+ * \brief Returns the table of the interned paths, indexed by hash
+ * \return Interned paths table
+ */
+static InternedNames& GetInternedNames() noexcept
 {
-    name = std::forward<std::string>(in_move.name);
+    // Function local to be usable by identifiers constructed during static initialization
+    static InternedNames interned_names;
+
+    return interned_names;
 }
 
-ResourceIdentifier::operator std::string() const noexcept
+#endif
+
+#pragma region Constructors
+
+ResourceIdentifier::ResourceIdentifier(std::string_view const in_name) noexcept:
+    hash {HashName(in_name)}
 {
-    return name;
+    #ifdef RUKEN_RESOURCE_IDENTIFIER_INTERNING
+
+    // Most identifiers are created from already interned paths, only a miss needs to lock the table exclusively
+    {
+        InternedNames::ReadAccess access(GetInternedNames());
+
+        if (auto const it = access->find(hash); it != access->cend())
+        {
+            if (it->second != in_name)
+                ReportCollision(it->second, in_name);
+
+            return;
+        }
+    }
+
+    std::string collision;
+
+    {
+        InternedNames::WriteAccess access(GetInternedNames());
+
+        // The path might have been interned since the read access was released
+        auto const [it, inserted] = access->try_emplace(hash, in_name);
+
+        if (!inserted && it->second != in_name)
+            collision = it->second;
+    }
+
+    if (!collision.empty())
+        ReportCollision(collision, in_name);
+
+    #endif
 }
 
-ResourceIdentifier& ResourceIdentifier::operator=(ResourceIdentifier const& in_copy) noexcept
-{
-    name = in_copy.name;
+#pragma endregion
+
+#pragma region Methods
 
-    return *this;
+RkVoid ResourceIdentifier::SetLogger(Logger* in_logger) noexcept
+{
+    collisions_logger.store(in_logger, std::memory_order_release);
 }
 
-ResourceIdentifier& ResourceIdentifier::operator=(ResourceIdentifier&& in_move) noexcept
+std::string ResourceIdentifier::GetName() const noexcept
 {
-    name = std::forward<std::string>(in_move.name);
+    #ifdef RUKEN_RESOURCE_IDENTIFIER_INTERNING
+
+    {
+        InternedNames::ReadAccess access(GetInternedNames());
 
-    return *this;
+        auto const it = access->find(hash);
+        if (it != access->cend())
+            return it->second;
+    }
+
+    #endif
+
+    // Unknown path, either not interned or hashed at compile time
+    std::array<RkChar, 18ULL> buffer {'0', 'x'};
+
+    auto const result = std::to_chars(buffer.data() + 2ULL, buffer.data() + buffer.size(), hash, 16);
+
+    return std::string(buffer.data(), result.ptr);
 }
 
-RkBool ResourceIdentifier::operator==(ResourceIdentifier const& in_other) const noexcept
+#pragma endregion
+
+#pragma region Operators
+
+ResourceIdentifier::operator std::string() const noexcept
 {
-    return name == in_other.name;
+    return GetName();
 }
+
+#pragma endregion
@@ -0,0 +1,55 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+constexpr RkUint64 ResourceIdentifier::HashName(std::string_view const in_name) noexcept
+{
+    RkUint64 hash = 0xcbf29ce484222325ULL;
+
+    for (RkChar const character: in_name)
+    {
+        hash ^= static_cast<RkUint8>(character);
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+consteval ResourceIdentifier ResourceIdentifier::FromLiteral(std::string_view const in_name) noexcept
+{
+    return FromHash(HashName(in_name));
+}
+
+constexpr ResourceIdentifier ResourceIdentifier::FromHash(RkUint64 const in_hash) noexcept
+{
+    ResourceIdentifier identifier;
+
+    identifier.hash = in_hash;
+
+    return identifier;
+}
+
+constexpr RkBool ResourceIdentifier::operator==(ResourceIdentifier const& in_other) const noexcept
+{
+    return hash == in_other.hash;
+}
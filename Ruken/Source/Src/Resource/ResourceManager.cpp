@@ -24,25 +24,35 @@
 
 #include <iostream>
 
+#include "IO/IOService.hpp"
+#include "Build/Config.hpp"
 #include "Core/ServiceProvider.hpp"
+#include "Threading/Futex.hpp"
+#include "Debug/Logging/Logger.hpp"
+#include "Debug/Tracing/TraceScope.hpp"
 #include "Resource/ResourceManager.hpp"
 #include "Resource/ResourceLoadingDescriptor.hpp"
 #include "Resource/ResourceProcessingFailure.hpp"
 
 USING_RUKEN_NAMESPACE
 
-RkVoid ResourceManager::LoadingRoutine(ResourceManifest* in_manifest, ResourceLoadingDescriptor const& in_descriptor)
+template <typename TLoader_Type>
+RkVoid ResourceManager::ProcessLoading(ResourceManifest* in_manifest, TLoader_Type&& in_loader)
 {
+    RUKEN_TRACE_SCOPE("Load resource", "Resource")
+
     in_manifest->status.store(EResourceStatus::Processed, std::memory_order_release);
 
     ++m_current_operation_count;
     
     try
     {
-        in_manifest->data.load(std::memory_order_acquire)->Load(*this, in_descriptor);
+        in_loader(*in_manifest->data.load(std::memory_order_acquire));
+
         in_manifest->status.store(EResourceStatus::Loaded, std::memory_order_release);
 
-        --m_current_operation_count;
+        EndOperation();
+        NotifyStatusChange(in_manifest);
 
         // Successfully loaded the resource
     }
@@ -50,11 +60,14 @@ RkVoid ResourceManager::LoadingRoutine(ResourceManifest* in_manifest, ResourceLo
     // Something happened
     catch (ResourceProcessingFailure const& failure)
     {
+        RUKEN_TRACE_INSTANT("Resource processing failure", "Resource")
+
         in_manifest->status.store(failure.resource_validity ? EResourceStatus::Loaded : EResourceStatus::Invalid, std::memory_order_release);
 
         std::cout << static_cast<std::string>(in_manifest->GetIdentifier()) << " failed to load. What: " << static_cast<std::string>(failure) << std::endl;
 
-        --m_current_operation_count;
+        EndOperation();
+        NotifyStatusChange(in_manifest);
 
         // If some resource tells us that there is not enough memory,
         // we are going to try to free up some in case of a retry (because we are nice ! :D)
@@ -63,13 +76,29 @@ RkVoid ResourceManager::LoadingRoutine(ResourceManifest* in_manifest, ResourceLo
     }
     catch(...)
     {
-        --m_current_operation_count;
+        EndOperation();
         throw;
     }
 }
 
+RkVoid ResourceManager::LoadingRoutine(ResourceManifest* in_manifest, ResourceLoadingDescriptor const& in_descriptor)
+{
+    ProcessLoading(in_manifest, [&in_descriptor, this] (IResource& in_resource) {
+        in_resource.Load(*this, in_descriptor);
+    });
+}
+
+RkVoid ResourceManager::LoadingRoutine(ResourceManifest* in_manifest, std::optional<std::span<RkByte const>> const in_source)
+{
+    ProcessLoading(in_manifest, [in_source, this] (IResource& in_resource) {
+        in_resource.LoadFromSource(*this, in_source);
+    });
+}
+
 RkVoid ResourceManager::ReloadingRoutine(ResourceManifest* in_manifest)
 {
+    RUKEN_TRACE_SCOPE("Reload resource", "Resource")
+
     if (!in_manifest || in_manifest->status.load(std::memory_order_acquire) != EResourceStatus::Loaded)
         return;
 
@@ -82,18 +111,22 @@ RkVoid ResourceManager::ReloadingRoutine(ResourceManifest* in_manifest)
         in_manifest->data.load(std::memory_order_acquire)->Reload(*this);
         in_manifest->status.store(EResourceStatus::Loaded, std::memory_order_release);
 
-        --m_current_operation_count;
-        
+        EndOperation();
+        NotifyStatusChange(in_manifest);
+
         // Successfully reloaded the resource
     }
 
     // Something happened
     catch (ResourceProcessingFailure const& failure)
     {
+        RUKEN_TRACE_INSTANT("Resource processing failure", "Resource")
+
         in_manifest->status.store(failure.resource_validity ? EResourceStatus::Loaded : EResourceStatus::Invalid, std::memory_order_release);
 
         std::cout << static_cast<std::string>(in_manifest->GetIdentifier()) << " failed to load. What: " << static_cast<std::string>(failure) << std::endl;
-        --m_current_operation_count;
+        EndOperation();
+        NotifyStatusChange(in_manifest);
 
         // If some resource tells us that there is not enough memory,
         // we are going to try to free up some in case of a retry (because we are nice ! :D)
@@ -102,13 +135,15 @@ RkVoid ResourceManager::ReloadingRoutine(ResourceManifest* in_manifest)
     }
     catch(...)
     {
-        --m_current_operation_count;
+        EndOperation();
         throw;
     }
 }
 
 RkVoid ResourceManager::UnloadingRoutine(ResourceManifest* in_manifest)
 {
+    RUKEN_TRACE_SCOPE("Unload resource", "Resource")
+
     if (!in_manifest)
         return;
 
@@ -120,7 +155,65 @@ RkVoid ResourceManager::UnloadingRoutine(ResourceManifest* in_manifest)
         in_manifest->status.store(EResourceStatus::Invalid, std::memory_order_release);
     }
 
-    --m_current_operation_count;
+    EndOperation();
+    NotifyStatusChange(in_manifest);
+}
+
+RkBool ResourceManager::StreamResource(ResourceManifest* in_manifest) noexcept
+{
+    if (!m_io_service)
+        return false;
+
+    RkChar const* path = in_manifest->data.load(std::memory_order_acquire)->GetSourcePath();
+
+    if (!path)
+        return false;
+
+    // The read counts as an operation, this way Cleanup() also waits for the reads in flight
+    ++m_current_operation_count;
+
+    m_io_service->ReadFile(path, [in_manifest, this] (std::vector<RkByte>&& in_content, RkInt64 const in_result) {
+        try
+        {
+            // If the read failed, the resource falls back on its own loading path which will report the error itself
+            if (in_result < 0)
+                LoadingRoutine(in_manifest, std::nullopt);
+            else
+                LoadingRoutine(in_manifest, std::span<RkByte const>(in_content));
+        }
+        catch(...)
+        {
+            EndOperation();
+            throw;
+        }
+
+        EndOperation();
+    }, EJobPriority::Background);
+
+    return true;
+}
+
+RkVoid ResourceManager::EndOperation() noexcept
+{
+    // Waking up Cleanup() if this was the last operation
+    if (m_current_operation_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        Futex::WakeAll(m_current_operation_count);
+}
+
+RkVoid ResourceManager::NotifyStatusChange(ResourceManifest* in_manifest) noexcept
+{
+    // Threads blocked in Handle::WaitForValidity()
+    Futex::WakeAll(in_manifest->status);
+
+    // Coroutines awaiting the handle, these are resumed on the workers instead of the current thread
+    std::vector<std::coroutine_handle<>> waiters;
+    {
+        std::lock_guard<std::mutex> lock(in_manifest->waiters_mutex);
+        waiters.swap(in_manifest->waiters);
+    }
+
+    for (std::coroutine_handle<> const waiter: waiters)
+        m_scheduler_reference.ScheduleTask([waiter] { waiter.resume(); });
 }
 
 RkVoid ResourceManager::InvalidateResource(ResourceManifest* in_manifest) noexcept
@@ -133,20 +226,19 @@ RkVoid ResourceManager::InvalidateResource(ResourceManifest* in_manifest) noexce
 
 ResourceManifest* ResourceManager::RequestManifest(ResourceIdentifier const& in_unique_identifier, RkBool const in_auto_create_manifest) noexcept
 {
-    ManifestsWriteAccess access(m_manifests);
+    // Most requests are made for resources that already have a manifest, this doesn't lock anything
+    ResourceManifest* manifest = m_manifests.Find(in_unique_identifier);
 
-    // If there is no such manifest in the map: adding a new one
-    if (access->find(in_unique_identifier) != access->end())
-        return access.Get()[in_unique_identifier];
+    if (manifest || !in_auto_create_manifest)
+        return manifest;
 
-    ResourceManifest* manifest = nullptr;
+    // Creating a new invalid manifest, another thread might have created one in the meantime
+    ResourceManifest* new_manifest = new ResourceManifest(in_unique_identifier, nullptr, EResourceGCStrategy::ReferenceCount);
 
-    // Creating a new invalid manifest.
-    if (in_auto_create_manifest)
-    {
-        manifest = new ResourceManifest(in_unique_identifier, nullptr, EResourceGCStrategy::ReferenceCount);
-        access.Get()[in_unique_identifier] = manifest;
-    }
+    manifest = m_manifests.FindOrInsert(in_unique_identifier, new_manifest);
+
+    if (manifest != new_manifest)
+        delete new_manifest;
 
     return manifest;
 }
@@ -154,21 +246,19 @@ ResourceManifest* ResourceManager::RequestManifest(ResourceIdentifier const& in_
 RkVoid ResourceManager::Cleanup() noexcept
 {
     // Waiting for any pending operations to be done to avoid concurrent accesses
-    while (m_current_operation_count.load(std::memory_order_acquire) > 0)
-        std::this_thread::yield();
-
-    ManifestsWriteAccess access(m_manifests);
+    for (RkUint32 count = m_current_operation_count.load(std::memory_order_acquire); count > 0;
+                  count = m_current_operation_count.load(std::memory_order_acquire))
+        Futex::Wait(m_current_operation_count, count);
 
     // The resources will be unloaded one by one, even if the resource manager gets deleted in the process
-    for (auto& pair : access.Get())
-    {
-        m_scheduler_reference.ScheduleTask([&] {
-            InvalidateResource(pair.second);
-            delete pair.second;
-        });
-    }
-
-    access->clear();
+    m_manifests.EraseIf([this] (ResourceManifest* in_manifest) {
+        m_scheduler_reference.ScheduleTask([in_manifest, this] {
+            InvalidateResource(in_manifest);
+            delete in_manifest;
+        }, EJobPriority::Background);
+
+        return true;
+    });
 }
 
 ResourceManager::ResourceManager(ServiceProvider& in_service_provider) noexcept:
@@ -176,14 +266,24 @@ ResourceManager::ResourceManager(ServiceProvider& in_service_provider) noexcept:
     m_manifests               {},
     m_collection_mode         {EGCCollectionMode::Automatic},
     m_scheduler_reference     {*m_service_provider.LocateService<Scheduler>()},
+    m_io_service              {m_service_provider.LocateService<IOService>()},
     m_current_operation_count {0}
-{}
+{
+    #if defined(RUKEN_LOGGING_ENABLED)
+
+        if (Logger* root_logger = m_service_provider.LocateService<Logger>())
+            ResourceIdentifier::SetLogger(root_logger->AddChild("Resource"));
+
+    #endif
+}
 
 ResourceManager::~ResourceManager() noexcept
 {
     // If the resource manager is destroyed, we need to make sure
     // that all resources are correctly deleted from memory to avoid leaks
     Cleanup();
+
+    ResourceIdentifier::SetLogger(nullptr);
 }
 
 RkVoid ResourceManager::TriggerSceneGC() noexcept
@@ -219,9 +319,9 @@ RkBool ResourceManager::UnloadResource(ResourceIdentifier const& in_identifier,
         UnloadingRoutine(manifest);
     else
     {
-        m_scheduler_reference.ScheduleTask([&manifest, this] {
+        m_scheduler_reference.ScheduleTask([manifest, this] {
             UnloadingRoutine(manifest);
-        });
+        }, EJobPriority::Background);
     }
 
     return true;
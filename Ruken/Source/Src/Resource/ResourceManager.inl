@@ -33,28 +33,21 @@ RkVoid ResourceManager::GarbageCollection(TUnary_Predicate in_predicate, RkBool
     if (m_current_operation_count.load(std::memory_order_acquire) > 0u)
         return;
 
-    ManifestsWriteAccess access(m_manifests);
-
-    // The loop doesn't auto increments the iterator because we might need to delete iterators while looping.
-    for (auto iterator = access->begin(); iterator != access->end();)
-    {
-        if (in_predicate(*iterator->second) && iterator->second->data)
+    m_manifests.EraseIf([&] (ResourceManifest* in_manifest) {
+        if (in_predicate(*in_manifest) && in_manifest->data)
         {
             // Scheduling the deletion
-            m_scheduler_reference.ScheduleTask([manifest = iterator->second, in_clear_invalid_resources, this] {
-                InvalidateResource(manifest);
+            m_scheduler_reference.ScheduleTask([in_manifest, in_clear_invalid_resources, this] {
+                InvalidateResource(in_manifest);
 
-                if (in_clear_invalid_resources && manifest->status.load(std::memory_order_acquire) == EResourceStatus::Invalid)
-                    delete manifest;
-            });
+                if (in_clear_invalid_resources && in_manifest->status.load(std::memory_order_acquire) == EResourceStatus::Invalid)
+                    delete in_manifest;
+            }, EJobPriority::Background);
         }
 
-        // If clearing invalid resources has been requested and the resource is invalid:
-        if (in_clear_invalid_resources && iterator->second->status.load(std::memory_order_acquire) == EResourceStatus::Invalid)
-            iterator = access->erase(iterator);
-        else
-            ++iterator;
-    }
+        // If clearing invalid resources has been requested and the resource is invalid: removing it from the table
+        return in_clear_invalid_resources && in_manifest->status.load(std::memory_order_acquire) == EResourceStatus::Invalid;
+    });
 }
 
 template <typename TResource_Type>
@@ -63,26 +56,30 @@ RkVoid ResourceManager::LoadResource(ResourceManifest* in_manifest, ResourceLoad
     if (!in_manifest)
         return;
 
-    {
-        // Since this method is susceptible to be called from multiple threads at once,
-        // this ensures that a resource doesn't gets loaded twice (or more)
+    // Since this method is susceptible to be called from multiple threads at once,
+    // this ensures that a resource doesn't gets loaded twice (or more)
+    EResourceStatus expected_status = EResourceStatus::Invalid;
 
-        // TODO move this in a special synchronization structure to avoid slowing down the whole manager
-        ManifestsWriteAccess access(m_manifests);
+    if (!in_manifest->status.compare_exchange_strong(expected_status, EResourceStatus::Pending, std::memory_order_acq_rel, std::memory_order_acquire))
+        return;
 
-        if (in_manifest->status.load(std::memory_order_acquire) != EResourceStatus::Invalid)
-            return;
+    TResource_Type* resource = new TResource_Type();
 
-        in_manifest->status.store(EResourceStatus::Pending, std::memory_order_release);
-        in_manifest->data  .store(new TResource_Type()    , std::memory_order_release);
-    }
+    in_manifest->data.store(resource, std::memory_order_release);
 
     if (in_loading_mode == ESynchronizationMode::Synchronous)
         return LoadingRoutine(in_manifest, in_descriptor);
 
-    m_scheduler_reference.ScheduleTask([in_manifest, &in_descriptor, this] {
-        LoadingRoutine(in_manifest, in_descriptor);
-    });
+    // The descriptor of the request might not outlive this call, the background load uses a copy kept by the resource
+    ResourceLoadingDescriptor const& descriptor = resource->KeepLoadingDescriptor(in_descriptor);
+
+    // Resources backed by a file are read by the IO service first, so that the loading job never waits on the disk
+    if (StreamResource(in_manifest))
+        return;
+
+    m_scheduler_reference.ScheduleTask([in_manifest, &descriptor, this] {
+        LoadingRoutine(in_manifest, descriptor);
+    }, EJobPriority::Background);
 }
 
 template <typename TResource_Type>
@@ -108,9 +105,9 @@ Handle<TResource_Type> ResourceManager::ReloadResource(Handle<TResource_Type> co
         ReloadingRoutine(in_handle.m_manifest);
     else
     {
-        m_scheduler_reference.ScheduleTask([&in_handle, this] {
-            ReloadingRoutine(in_handle.m_manifest);
-        });
+        m_scheduler_reference.ScheduleTask([manifest = in_handle.m_manifest, this] {
+            ReloadingRoutine(manifest);
+        }, EJobPriority::Background);
     }
 
     return in_handle;
@@ -119,20 +116,20 @@ Handle<TResource_Type> ResourceManager::ReloadResource(Handle<TResource_Type> co
 template <typename TResource_Type>
 Handle<TResource_Type> ResourceManager::ReferenceResource(ResourceIdentifier const& in_unique_identifier, TResource_Type* in_resource, EResourceGCStrategy const in_strategy) noexcept
 {
-    ManifestsWriteAccess access(m_manifests);
-
-    // If there is already a manifest with the target name or the resource is an empty pointer
-    if (access->find(in_unique_identifier) != access->end() || !in_resource)
+    if (!in_resource)
         return Handle<TResource_Type>(nullptr);
 
-    // Otherwise, referencing the resource
-    ResourceManifest* manifest = new ResourceManifest();
-    access.Get()[in_unique_identifier] = manifest;
-
-    manifest->gc_strategy    = in_strategy;
-    manifest->data            = in_resource;
+    // The manifest is fully initialized before being published
+    ResourceManifest* manifest = new ResourceManifest(in_unique_identifier, in_resource, in_strategy);
     manifest->status.store(EResourceStatus::Loaded, std::memory_order_release);
 
+    // If there is already a manifest with the target name
+    if (m_manifests.FindOrInsert(in_unique_identifier, manifest) != manifest)
+    {
+        delete manifest;
+        return Handle<TResource_Type>(nullptr);
+    }
+
     return Handle<TResource_Type>(manifest);
 }
 
@@ -149,9 +146,9 @@ Handle<TResource_Type> ResourceManager::ReloadResource(ResourceIdentifier const&
         ReloadingRoutine(manifest);
     else
     {
-        m_scheduler_reference.ScheduleTask([&manifest, this] {
+        m_scheduler_reference.ScheduleTask([manifest, this] {
             ReloadingRoutine(manifest);
-        });
+        }, EJobPriority::Background);
     }
 
     return Handle<TResource_Type>(manifest);
@@ -0,0 +1,236 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include "Resource/ResourceManifest.hpp"
+#include "Resource/ResourceManifestTable.hpp"
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Constructors
+
+ResourceManifestTable::ResourceManifestTable() noexcept
+{
+    for (Shard& shard: m_shards)
+        shard.slots.store(CreateSlots(RUKEN_RESOURCE_MANIFEST_TABLE_SHARD_CAPACITY).release(), std::memory_order_relaxed);
+}
+
+ResourceManifestTable::~ResourceManifestTable() noexcept
+{
+    // No reader can be left at this point
+    for (Shard& shard: m_shards)
+    {
+        std::unique_ptr<Slots> const slots(shard.slots.load(std::memory_order_acquire));
+
+        for (RkSize index = 0ULL; index < slots->capacity; ++index)
+        {
+            Entry* entry = slots->entries[index].load(std::memory_order_relaxed);
+
+            if (entry != &m_tombstone)
+                delete entry;
+        }
+    }
+}
+
+#pragma endregion
+
+#pragma region Methods
+
+RkSize ResourceManifestTable::Hash(ResourceIdentifier const& in_identifier) noexcept
+{
+    RkSize hash = std::hash<ResourceIdentifier>()(in_identifier);
+
+    // Mixing the bits, the shard is selected by the lowest bits of the hash which are weak for FNV-1a
+    hash ^= hash >> 33ULL;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33ULL;
+
+    return hash;
+}
+
+std::unique_ptr<ResourceManifestTable::Slots> ResourceManifestTable::CreateSlots(RkSize const in_capacity) noexcept
+{
+    std::unique_ptr<Slots> slots = std::make_unique<Slots>();
+
+    slots->capacity = in_capacity;
+    slots->entries  = std::make_unique<std::atomic<Entry*>[]>(in_capacity);
+
+    return slots;
+}
+
+RkVoid ResourceManifestTable::Rebuild(Shard& in_shard) noexcept
+{
+    Slots* slots = in_shard.slots.load(std::memory_order_relaxed);
+
+    // Growing if more than half of the slots are in use, otherwise only getting rid of the tombstones
+    RkSize const           capacity  = in_shard.entries_count * 2ULL >= slots->capacity ? slots->capacity * 2ULL : slots->capacity;
+    std::unique_ptr<Slots> new_slots = CreateSlots(capacity);
+
+    for (RkSize index = 0ULL; index < slots->capacity; ++index)
+    {
+        Entry* entry = slots->entries[index].load(std::memory_order_relaxed);
+
+        if (!entry || entry == &m_tombstone)
+            continue;
+
+        RkSize new_index = (entry->hash >> shard_bits) & (capacity - 1ULL);
+        while (new_slots->entries[new_index].load(std::memory_order_relaxed))
+            new_index = (new_index + 1ULL) & (capacity - 1ULL);
+
+        new_slots->entries[new_index].store(entry, std::memory_order_relaxed);
+    }
+
+    in_shard.used_count = in_shard.entries_count;
+
+    // Entries are shared by both arrays, only the old array is retired.
+    // Readers that loaded the old array before this exchange announced an epoch prior to the retirement one
+    std::unique_ptr<Slots> old_slots(in_shard.slots.exchange(new_slots.release(), std::memory_order_seq_cst));
+
+    in_shard.retired_values.push_back({ReadEpoch::Advance(), nullptr, std::move(old_slots)});
+}
+
+RkVoid ResourceManifestTable::Remove(Shard& in_shard, std::atomic<Entry*>& in_slot) noexcept
+{
+    std::unique_ptr<Entry> entry(in_slot.exchange(&m_tombstone, std::memory_order_seq_cst));
+
+    --in_shard.entries_count;
+
+    in_shard.retired_values.push_back({ReadEpoch::Advance(), std::move(entry), nullptr});
+}
+
+RkVoid ResourceManifestTable::DestroyReclaimableValues(Shard& in_shard) noexcept
+{
+    std::erase_if(in_shard.retired_values, [](RetiredValue const& in_retired_value) {
+        return ReadEpoch::IsReclaimable(in_retired_value.epoch);
+    });
+}
+
+ResourceManifest* ResourceManifestTable::Find(ResourceIdentifier const& in_identifier) const noexcept
+{
+    RkSize const hash  = Hash(in_identifier);
+    Shard const& shard = m_shards[hash & (RUKEN_RESOURCE_MANIFEST_TABLE_SHARDS - 1ULL)];
+
+    ResourceManifest* manifest = nullptr;
+
+    // The read section must be announced before loading anything, see ReadEpoch
+    ReadEpoch::Enter();
+
+    Slots const* slots = shard.slots.load(std::memory_order_seq_cst);
+    RkSize const mask  = slots->capacity - 1ULL;
+
+    // Probing at most every slot once, a shard always has some empty slots but the array might be a retired one
+    for (RkSize probe = 0ULL, index = (hash >> shard_bits) & mask; probe < slots->capacity; ++probe, index = (index + 1ULL) & mask)
+    {
+        Entry const* entry = slots->entries[index].load(std::memory_order_seq_cst);
+
+        if (!entry)
+            break;
+
+        if (entry != &m_tombstone && entry->hash == hash && entry->identifier == in_identifier)
+        {
+            manifest = entry->manifest;
+            break;
+        }
+    }
+
+    ReadEpoch::Exit();
+
+    return manifest;
+}
+
+ResourceManifest* ResourceManifestTable::FindOrInsert(ResourceIdentifier const& in_identifier, ResourceManifest* in_manifest) noexcept
+{
+    RkSize const hash  = Hash(in_identifier);
+    Shard&       shard = m_shards[hash & (RUKEN_RESOURCE_MANIFEST_TABLE_SHARDS - 1ULL)];
+
+    std::lock_guard lock(shard.mutex);
+
+    DestroyReclaimableValues(shard);
+
+    // Keeping the load factor under 3/4, tombstones included, so that probing stays short
+    if ((shard.used_count + 1ULL) * 4ULL > shard.slots.load(std::memory_order_relaxed)->capacity * 3ULL)
+        Rebuild(shard);
+
+    Slots*       slots = shard.slots.load(std::memory_order_relaxed);
+    RkSize const mask  = slots->capacity - 1ULL;
+
+    std::atomic<Entry*>* free_slot = nullptr;
+
+    for (RkSize index = (hash >> shard_bits) & mask;; index = (index + 1ULL) & mask)
+    {
+        Entry* entry = slots->entries[index].load(std::memory_order_relaxed);
+
+        // Reusing the first tombstone of the probing sequence, if any
+        if (entry == &m_tombstone)
+        {
+            if (!free_slot)
+                free_slot = &slots->entries[index];
+
+            continue;
+        }
+
+        if (!entry)
+        {
+            if (!free_slot)
+            {
+                free_slot = &slots->entries[index];
+                ++shard.used_count;
+            }
+
+            break;
+        }
+
+        if (entry->hash == hash && entry->identifier == in_identifier)
+            return entry->manifest;
+    }
+
+    ++shard.entries_count;
+
+    // Readers only see the entry once it has been fully constructed
+    free_slot->store(new Entry {in_identifier, hash, in_manifest}, std::memory_order_release);
+
+    return in_manifest;
+}
+
+RkVoid ResourceManifestTable::Clear() noexcept
+{
+    EraseIf([](ResourceManifest*) {
+        return true;
+    });
+}
+
+RkSize ResourceManifestTable::GetSize() noexcept
+{
+    RkSize size = 0ULL;
+
+    for (Shard& shard: m_shards)
+    {
+        std::lock_guard lock(shard.mutex);
+
+        size += shard.entries_count;
+    }
+
+    return size;
+}
+
+#pragma endregion
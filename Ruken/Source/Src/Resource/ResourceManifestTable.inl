@@ -0,0 +1,68 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+template <typename TPredicate>
+RkVoid ResourceManifestTable::EraseIf(TPredicate&& in_predicate) noexcept
+{
+    for (Shard& shard: m_shards)
+    {
+        std::lock_guard lock(shard.mutex);
+
+        Slots* slots         = shard.slots.load(std::memory_order_relaxed);
+        RkSize entries_count = shard.entries_count;
+
+        for (RkSize index = 0ULL; index < slots->capacity; ++index)
+        {
+            Entry* entry = slots->entries[index].load(std::memory_order_relaxed);
+
+            if (entry && entry != &m_tombstone && in_predicate(entry->manifest))
+                Remove(shard, slots->entries[index]);
+        }
+
+        // Getting rid of the tombstones right away, lookups would otherwise have to probe past them until the next insertion
+        if (shard.entries_count != entries_count)
+            Rebuild(shard);
+
+        DestroyReclaimableValues(shard);
+    }
+}
+
+template <typename TFunction>
+RkVoid ResourceManifestTable::ForEach(TFunction&& in_function) noexcept
+{
+    for (Shard& shard: m_shards)
+    {
+        std::lock_guard lock(shard.mutex);
+
+        Slots* slots = shard.slots.load(std::memory_order_relaxed);
+
+        for (RkSize index = 0ULL; index < slots->capacity; ++index)
+        {
+            Entry* entry = slots->entries[index].load(std::memory_order_relaxed);
+
+            if (entry && entry != &m_tombstone)
+                in_function(entry->manifest);
+        }
+    }
+}
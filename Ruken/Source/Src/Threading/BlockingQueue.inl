@@ -0,0 +1,171 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma region Constructors
+
+template <template <typename> class TQueue, typename TType>
+BlockingQueue<TQueue, TType>::BlockingQueue(RkSize const in_capacity) noexcept:
+    m_queue {in_capacity}
+{ }
+
+#pragma endregion
+
+#pragma region Methods
+
+template <template <typename> class TQueue, typename TType>
+RkVoid BlockingQueue<TQueue, TType>::Notify(std::atomic<RkUint32>& in_epoch, std::atomic<RkUint32> const& in_waiting_count) noexcept
+{
+    // Pairs with the fence of WaitFor: either the waiting thread sees our operation when retrying, or we see it waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (in_waiting_count.load(std::memory_order_relaxed) > 0U)
+    {
+        in_epoch.fetch_add(1U, std::memory_order_release);
+        in_epoch.notify_all();
+    }
+}
+
+template <template <typename> class TQueue, typename TType>
+template <typename TOperation>
+RkBool BlockingQueue<TQueue, TType>::WaitFor(TOperation&& in_operation, std::atomic<RkUint32>& in_epoch, std::atomic<RkUint32>& in_waiting_count) noexcept
+{
+    // Spinning and yielding a bit first, parking costs a system call on both sides
+    for (RkUint32 attempt = 0U; attempt < spin_count + yield_count; ++attempt)
+    {
+        if (in_operation())
+            return true;
+
+        if (m_released.load(std::memory_order_acquire))
+            return false;
+
+        if (attempt < spin_count)
+            CpuRelax();
+        else
+            std::this_thread::yield();
+    }
+
+    while (!in_operation())
+    {
+        // The epoch must be read before announcing the wait, this way any notification sent after our last try wakes us up
+        RkUint32 const epoch = in_epoch.load(std::memory_order_acquire);
+
+        in_waiting_count.fetch_add(1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        RkBool const succeeded = in_operation();
+        if (!succeeded && !m_released.load(std::memory_order_relaxed))
+            in_epoch.wait(epoch, std::memory_order_acquire);
+
+        in_waiting_count.fetch_sub(1U, std::memory_order_relaxed);
+
+        if (succeeded)
+            return true;
+
+        if (m_released.load(std::memory_order_acquire))
+            return false;
+    }
+
+    return true;
+}
+
+template <template <typename> class TQueue, typename TType>
+RkBool BlockingQueue<TQueue, TType>::Enqueue(TType&& in_item) noexcept
+{
+    if (m_released.load(std::memory_order_acquire))
+        return false;
+
+    if (!WaitFor([&] { return m_queue.TryEnqueue(std::move(in_item)); }, m_dequeue_epoch, m_waiting_producers))
+        return false;
+
+    Notify(m_enqueue_epoch, m_waiting_consumers);
+
+    return true;
+}
+
+template <template <typename> class TQueue, typename TType>
+RkBool BlockingQueue<TQueue, TType>::Dequeue(TType& out_item) noexcept
+{
+    // Once released, the remaining items can still be dequeued without blocking
+    if (!WaitFor([&] { return m_queue.TryDequeue(out_item); }, m_enqueue_epoch, m_waiting_consumers) && !m_queue.TryDequeue(out_item))
+        return false;
+
+    Notify(m_dequeue_epoch, m_waiting_producers);
+
+    return true;
+}
+
+template <template <typename> class TQueue, typename TType>
+RkSize BlockingQueue<TQueue, TType>::DequeueBatch(TType* out_items, RkSize const in_max_count) noexcept
+{
+    RkSize count = 0ULL;
+
+    if (!WaitFor([&] { return (count = m_queue.TryDequeueBatch(out_items, in_max_count)) > 0ULL; }, m_enqueue_epoch, m_waiting_consumers))
+        count = m_queue.TryDequeueBatch(out_items, in_max_count);
+
+    if (count > 0ULL)
+        Notify(m_dequeue_epoch, m_waiting_producers);
+
+    return count;
+}
+
+template <template <typename> class TQueue, typename TType>
+RkBool BlockingQueue<TQueue, TType>::TryEnqueue(TType&& in_item) noexcept
+{
+    if (m_released.load(std::memory_order_acquire) || !m_queue.TryEnqueue(std::move(in_item)))
+        return false;
+
+    Notify(m_enqueue_epoch, m_waiting_consumers);
+
+    return true;
+}
+
+template <template <typename> class TQueue, typename TType>
+RkBool BlockingQueue<TQueue, TType>::TryDequeue(TType& out_item) noexcept
+{
+    if (!m_queue.TryDequeue(out_item))
+        return false;
+
+    Notify(m_dequeue_epoch, m_waiting_producers);
+
+    return true;
+}
+
+template <template <typename> class TQueue, typename TType>
+RkVoid BlockingQueue<TQueue, TType>::Release() noexcept
+{
+    m_released.store(true, std::memory_order_release);
+
+    m_enqueue_epoch.fetch_add(1U, std::memory_order_release);
+    m_dequeue_epoch.fetch_add(1U, std::memory_order_release);
+    m_enqueue_epoch.notify_all();
+    m_dequeue_epoch.notify_all();
+}
+
+template <template <typename> class TQueue, typename TType>
+TQueue<TType>& BlockingQueue<TQueue, TType>::GetQueue() noexcept
+{
+    return m_queue;
+}
+
+#pragma endregion
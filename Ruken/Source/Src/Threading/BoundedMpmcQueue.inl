@@ -0,0 +1,229 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma region Cell
+
+template <typename TType>
+TType* BoundedMpmcQueue<TType>::Cell::Item() noexcept
+{
+    return std::launder(reinterpret_cast<TType*>(storage));
+}
+
+#pragma endregion
+
+#pragma region Constructors
+
+template <typename TType>
+BoundedMpmcQueue<TType>::BoundedMpmcQueue(RkSize const in_capacity) noexcept:
+    m_cells {std::make_unique<Cell[]>(std::bit_ceil(std::max<RkSize>(in_capacity, 2ULL)))},
+    m_mask  {std::bit_ceil(std::max<RkSize>(in_capacity, 2ULL)) - 1ULL}
+{
+    // Every cell is initially ready to be written for its first position
+    for (RkSize index = 0ULL; index <= m_mask; ++index)
+        m_cells[index].sequence.store(index, std::memory_order_relaxed);
+}
+
+template <typename TType>
+BoundedMpmcQueue<TType>::~BoundedMpmcQueue() noexcept
+{
+    RkSize const end = m_enqueue_position.load(std::memory_order_relaxed);
+
+    for (RkSize position = m_dequeue_position.load(std::memory_order_relaxed); position != end; ++position)
+        std::destroy_at(m_cells[position & m_mask].Item());
+}
+
+#pragma endregion
+
+#pragma region Methods
+
+template <typename TType>
+RkBool BoundedMpmcQueue<TType>::TryEnqueue(TType&& in_item) noexcept
+{
+    RkSize position = m_enqueue_position.load(std::memory_order_relaxed);
+    Cell*  cell;
+
+    while (true)
+    {
+        cell = &m_cells[position & m_mask];
+
+        RkSize  const sequence   = cell->sequence.load(std::memory_order_acquire);
+        RkInt64 const difference = static_cast<RkInt64>(sequence) - static_cast<RkInt64>(position);
+
+        // The cell is free for this position, trying to claim it
+        if (difference == 0LL)
+        {
+            if (m_enqueue_position.compare_exchange_weak(position, position + 1ULL, std::memory_order_relaxed))
+                break;
+        }
+
+        // The cell still holds the item of the previous lap, the queue is full
+        else if (difference < 0LL)
+            return false;
+
+        // Another producer claimed this position meanwhile
+        else
+            position = m_enqueue_position.load(std::memory_order_relaxed);
+    }
+
+    std::construct_at(cell->Item(), std::move(in_item));
+    cell->sequence.store(position + 1ULL, std::memory_order_release);
+
+    return true;
+}
+
+template <typename TType>
+RkBool BoundedMpmcQueue<TType>::TryDequeue(TType& out_item) noexcept
+{
+    RkSize position = m_dequeue_position.load(std::memory_order_relaxed);
+    Cell*  cell;
+
+    while (true)
+    {
+        cell = &m_cells[position & m_mask];
+
+        RkSize  const sequence   = cell->sequence.load(std::memory_order_acquire);
+        RkInt64 const difference = static_cast<RkInt64>(sequence) - static_cast<RkInt64>(position + 1ULL);
+
+        // The cell holds the item of this position, trying to claim it
+        if (difference == 0LL)
+        {
+            if (m_dequeue_position.compare_exchange_weak(position, position + 1ULL, std::memory_order_relaxed))
+                break;
+        }
+
+        // The cell has not been written yet, the queue is empty
+        else if (difference < 0LL)
+            return false;
+
+        // Another consumer claimed this position meanwhile
+        else
+            position = m_dequeue_position.load(std::memory_order_relaxed);
+    }
+
+    out_item = std::move(*cell->Item());
+    std::destroy_at(cell->Item());
+
+    // The cell is now free for the same index on the next lap
+    cell->sequence.store(position + m_mask + 1ULL, std::memory_order_release);
+
+    return true;
+}
+
+template <typename TType>
+RkSize BoundedMpmcQueue<TType>::TryEnqueueBatch(TType* in_items, RkSize const in_count) noexcept
+{
+    RkSize position = m_enqueue_position.load(std::memory_order_relaxed);
+    RkSize count    = 0ULL;
+
+    while (true)
+    {
+        // Counting the contiguous cells free for their position, starting from the current one
+        count = 0ULL;
+        while (count < in_count && m_cells[(position + count) & m_mask].sequence.load(std::memory_order_acquire) == position + count)
+            ++count;
+
+        if (count == 0ULL)
+        {
+            // Either the queue is full, or another producer claimed the position meanwhile
+            RkSize const current_position = m_enqueue_position.load(std::memory_order_relaxed);
+            if (current_position == position)
+                return 0ULL;
+
+            position = current_position;
+            continue;
+        }
+
+        // Only the claiming producer can write the counted cells, they can't be taken by anyone else if this succeeds
+        if (m_enqueue_position.compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+            break;
+    }
+
+    for (RkSize index = 0ULL; index < count; ++index)
+    {
+        Cell& cell = m_cells[(position + index) & m_mask];
+
+        std::construct_at(cell.Item(), std::move(in_items[index]));
+        cell.sequence.store(position + index + 1ULL, std::memory_order_release);
+    }
+
+    return count;
+}
+
+template <typename TType>
+RkSize BoundedMpmcQueue<TType>::TryDequeueBatch(TType* out_items, RkSize const in_max_count) noexcept
+{
+    RkSize position = m_dequeue_position.load(std::memory_order_relaxed);
+    RkSize count    = 0ULL;
+
+    while (true)
+    {
+        // Counting the contiguous cells holding the item of their position, starting from the current one
+        count = 0ULL;
+        while (count < in_max_count && m_cells[(position + count) & m_mask].sequence.load(std::memory_order_acquire) == position + count + 1ULL)
+            ++count;
+
+        if (count == 0ULL)
+        {
+            // Either the queue is empty, or another consumer claimed the position meanwhile
+            RkSize const current_position = m_dequeue_position.load(std::memory_order_relaxed);
+            if (current_position == position)
+                return 0ULL;
+
+            position = current_position;
+            continue;
+        }
+
+        if (m_dequeue_position.compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+            break;
+    }
+
+    for (RkSize index = 0ULL; index < count; ++index)
+    {
+        Cell& cell = m_cells[(position + index) & m_mask];
+
+        out_items[index] = std::move(*cell.Item());
+        std::destroy_at(cell.Item());
+
+        cell.sequence.store(position + index + m_mask + 1ULL, std::memory_order_release);
+    }
+
+    return count;
+}
+
+template <typename TType>
+RkSize BoundedMpmcQueue<TType>::GetCapacity() const noexcept
+{
+    return m_mask + 1ULL;
+}
+
+template <typename TType>
+RkSize BoundedMpmcQueue<TType>::GetApproximateSize() const noexcept
+{
+    RkSize const dequeue_position = m_dequeue_position.load(std::memory_order_relaxed);
+    RkSize const enqueue_position = m_enqueue_position.load(std::memory_order_relaxed);
+
+    return enqueue_position > dequeue_position ? enqueue_position - dequeue_position : 0ULL;
+}
+
+#pragma endregion
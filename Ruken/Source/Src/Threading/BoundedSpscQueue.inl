@@ -0,0 +1,129 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma region Cell
+
+template <typename TType>
+TType* BoundedSpscQueue<TType>::Cell::Item() noexcept
+{
+    return std::launder(reinterpret_cast<TType*>(storage));
+}
+
+#pragma endregion
+
+#pragma region Constructors
+
+template <typename TType>
+BoundedSpscQueue<TType>::BoundedSpscQueue(RkSize const in_capacity) noexcept:
+    m_cells {std::make_unique<Cell[]>(std::bit_ceil(std::max<RkSize>(in_capacity, 2ULL)))},
+    m_mask  {std::bit_ceil(std::max<RkSize>(in_capacity, 2ULL)) - 1ULL}
+{ }
+
+template <typename TType>
+BoundedSpscQueue<TType>::~BoundedSpscQueue() noexcept
+{
+    RkSize const tail = m_tail.load(std::memory_order_relaxed);
+
+    for (RkSize position = m_head.load(std::memory_order_relaxed); position != tail; ++position)
+        std::destroy_at(m_cells[position & m_mask].Item());
+}
+
+#pragma endregion
+
+#pragma region Methods
+
+template <typename TType>
+RkBool BoundedSpscQueue<TType>::TryEnqueue(TType&& in_item) noexcept
+{
+    return TryEnqueueBatch(&in_item, 1ULL) == 1ULL;
+}
+
+template <typename TType>
+RkBool BoundedSpscQueue<TType>::TryDequeue(TType& out_item) noexcept
+{
+    return TryDequeueBatch(&out_item, 1ULL) == 1ULL;
+}
+
+template <typename TType>
+RkSize BoundedSpscQueue<TType>::TryEnqueueBatch(TType* in_items, RkSize const in_count) noexcept
+{
+    RkSize const tail     = m_tail.load(std::memory_order_relaxed);
+    RkSize const capacity = m_mask + 1ULL;
+
+    // Only reading the head of the consumer if the queue looks too full for the whole batch
+    if (tail - m_cached_head + in_count > capacity)
+        m_cached_head = m_head.load(std::memory_order_acquire);
+
+    RkSize const count = std::min(in_count, capacity - (tail - m_cached_head));
+
+    for (RkSize index = 0ULL; index < count; ++index)
+        std::construct_at(m_cells[(tail + index) & m_mask].Item(), std::move(in_items[index]));
+
+    if (count > 0ULL)
+        m_tail.store(tail + count, std::memory_order_release);
+
+    return count;
+}
+
+template <typename TType>
+RkSize BoundedSpscQueue<TType>::TryDequeueBatch(TType* out_items, RkSize const in_max_count) noexcept
+{
+    RkSize const head = m_head.load(std::memory_order_relaxed);
+
+    // Only reading the tail of the producer if the queue looks too empty for the whole batch
+    if (m_cached_tail - head < in_max_count)
+        m_cached_tail = m_tail.load(std::memory_order_acquire);
+
+    RkSize const count = std::min(in_max_count, m_cached_tail - head);
+
+    for (RkSize index = 0ULL; index < count; ++index)
+    {
+        TType* item = m_cells[(head + index) & m_mask].Item();
+
+        out_items[index] = std::move(*item);
+        std::destroy_at(item);
+    }
+
+    if (count > 0ULL)
+        m_head.store(head + count, std::memory_order_release);
+
+    return count;
+}
+
+template <typename TType>
+RkSize BoundedSpscQueue<TType>::GetCapacity() const noexcept
+{
+    return m_mask + 1ULL;
+}
+
+template <typename TType>
+RkSize BoundedSpscQueue<TType>::GetApproximateSize() const noexcept
+{
+    RkSize const head = m_head.load(std::memory_order_relaxed);
+    RkSize const tail = m_tail.load(std::memory_order_relaxed);
+
+    return tail > head ? tail - head : 0ULL;
+}
+
+#pragma endregion
@@ -0,0 +1,63 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <thread>
+
+#include "Threading/CompletionToken.hpp"
+
+USING_RUKEN_NAMESPACE
+
+RkVoid CompletionToken::Add(RkUint32 const in_count) noexcept
+{
+    m_state.fetch_add(in_count, std::memory_order_relaxed);
+}
+
+RkVoid CompletionToken::Complete() noexcept
+{
+    // Registering as a completer while removing the job, in a single step
+    RkUint64 const state = m_state.fetch_add(completer_unit - 1ULL, std::memory_order_acq_rel) + completer_unit - 1ULL;
+
+    if ((state & pending_mask) == 0ULL)
+        m_state.notify_all();
+
+    // Nothing must touch the token after this, the waiting threads might destroy it right away
+    m_state.fetch_sub(completer_unit, std::memory_order_release);
+}
+
+RkBool CompletionToken::IsComplete() const noexcept
+{
+    return m_state.load(std::memory_order_acquire) == 0ULL;
+}
+
+RkVoid CompletionToken::Wait() const noexcept
+{
+    for (RkUint64 state = m_state.load(std::memory_order_acquire); state != 0ULL; state = m_state.load(std::memory_order_acquire))
+    {
+        // Every job is done, only waiting for the last completer to be done notifying, this is very short
+        if ((state & pending_mask) == 0ULL)
+            std::this_thread::yield();
+        else
+            m_state.wait(state, std::memory_order_acquire);
+    }
+}
@@ -0,0 +1,163 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma region Synchronized
+
+template <typename TType>
+template <typename ...TArgs, typename>
+Synchronized<TType, ESynchronizationPolicy::CopyOnWrite>::Synchronized(TArgs... in_args):
+    m_value {new TType(std::forward<TArgs>(in_args)...)}
+{}
+
+template <typename TType>
+Synchronized<TType, ESynchronizationPolicy::CopyOnWrite>::Synchronized():
+    m_value {new TType()}
+{}
+
+template <typename TType>
+Synchronized<TType, ESynchronizationPolicy::CopyOnWrite>::~Synchronized() noexcept
+{
+    // No reader can be left at this point
+    delete m_value.load(std::memory_order_acquire);
+}
+
+template <typename TType>
+RkVoid Synchronized<TType, ESynchronizationPolicy::CopyOnWrite>::Publish(std::unique_ptr<TType> in_value) noexcept
+{
+    // Readers that loaded the previous value before this exchange announced an epoch prior to the retirement one
+    TType const* previous_value = m_value.exchange(in_value.release(), std::memory_order_seq_cst);
+
+    m_retired_values.push_back({ReadEpoch::Advance(), std::unique_ptr<TType const>(previous_value)});
+
+    DestroyReclaimableValues();
+}
+
+template <typename TType>
+RkVoid Synchronized<TType, ESynchronizationPolicy::CopyOnWrite>::DestroyReclaimableValues() noexcept
+{
+    std::erase_if(m_retired_values, [](RetiredValue const& in_retired_value) {
+        return ReadEpoch::IsReclaimable(in_retired_value.epoch);
+    });
+}
+
+template <typename TType>
+RkVoid Synchronized<TType, ESynchronizationPolicy::CopyOnWrite>::Reclaim() noexcept
+{
+    std::lock_guard lock(m_write_mutex);
+
+    DestroyReclaimableValues();
+}
+
+#pragma endregion
+
+#pragma region Read access
+
+template <class TData, EAccessMode TMode>
+CopyOnWriteAccess<TData, TMode>::CopyOnWriteAccess(Synchronized<TData, ESynchronizationPolicy::CopyOnWrite> const& in_synchronized) noexcept
+{
+    // The read section must be announced before loading the value, see ReadEpoch
+    ReadEpoch::Enter();
+
+    m_value = in_synchronized.m_value.load(std::memory_order_seq_cst);
+}
+
+template <class TData, EAccessMode TMode>
+CopyOnWriteAccess<TData, TMode>::~CopyOnWriteAccess() noexcept
+{
+    ReadEpoch::Exit();
+}
+
+template <class TData, EAccessMode TMode>
+TData const& CopyOnWriteAccess<TData, TMode>::Get() const noexcept
+{
+    return *m_value;
+}
+
+template <class TData, EAccessMode TMode>
+TData const& CopyOnWriteAccess<TData, TMode>::operator*() const noexcept
+{
+    return *m_value;
+}
+
+template <class TData, EAccessMode TMode>
+TData const* CopyOnWriteAccess<TData, TMode>::operator->() const noexcept
+{
+    return m_value;
+}
+
+#pragma endregion
+
+#pragma region Write access
+
+template <class TData>
+CopyOnWriteAccess<TData, EAccessMode::Write>::CopyOnWriteAccess(Synchronized<TData, ESynchronizationPolicy::CopyOnWrite>& in_synchronized):
+    m_synchronized {in_synchronized},
+    m_lock         {in_synchronized.m_write_mutex},
+    m_value        {std::make_unique<TData>(*in_synchronized.m_value.load(std::memory_order_acquire))}
+{}
+
+template <class TData>
+CopyOnWriteAccess<TData, EAccessMode::Write>::~CopyOnWriteAccess() noexcept
+{
+    // The write mutex is still locked here, it is only released once the members are destroyed
+    m_synchronized.Publish(std::move(m_value));
+}
+
+template <class TData>
+TData& CopyOnWriteAccess<TData, EAccessMode::Write>::Get() noexcept
+{
+    return *m_value;
+}
+
+template <class TData>
+TData const& CopyOnWriteAccess<TData, EAccessMode::Write>::Get() const noexcept
+{
+    return *m_value;
+}
+
+template <class TData>
+TData& CopyOnWriteAccess<TData, EAccessMode::Write>::operator*() noexcept
+{
+    return *m_value;
+}
+
+template <class TData>
+TData const& CopyOnWriteAccess<TData, EAccessMode::Write>::operator*() const noexcept
+{
+    return *m_value;
+}
+
+template <class TData>
+TData* CopyOnWriteAccess<TData, EAccessMode::Write>::operator->() noexcept
+{
+    return m_value.get();
+}
+
+template <class TData>
+TData const* CopyOnWriteAccess<TData, EAccessMode::Write>::operator->() const noexcept
+{
+    return m_value.get();
+}
+
+#pragma endregion
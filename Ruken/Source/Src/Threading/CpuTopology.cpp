@@ -0,0 +1,274 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <map>
+#include <thread>
+#include <algorithm>
+
+#include "Build/OperatingSystem.hpp"
+#include "Threading/CpuTopology.hpp"
+
+#if defined(RUKEN_OS_WINDOWS)
+    #include <memory>
+    #include "Utility/WindowsOS.hpp"
+#elif defined(RUKEN_OS_LINUX)
+    #include <cstdio>
+    #include <string>
+    #include <fstream>
+    #include <sched.h>
+#endif
+
+USING_RUKEN_NAMESPACE
+
+CpuTopology::CpuTopology() noexcept
+{
+    if (!QueryProcessors() || m_processors.empty())
+    {
+        // Unknown topology, every hardware thread is considered to be its own core
+        m_processors.clear();
+
+        RkUint32 const processors_count = std::max(std::thread::hardware_concurrency(), 1U);
+        for (RkUint32 index = 0U; index < processors_count; ++index)
+            m_processors.push_back({.number = index, .core = index});
+    }
+
+    Normalize();
+}
+
+#if defined(RUKEN_OS_WINDOWS)
+
+RkBool CpuTopology::QueryProcessors() noexcept
+{
+    DWORD length = 0;
+    GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+    if (GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+        return false;
+
+    std::unique_ptr<std::byte[]> const buffer = std::make_unique<std::byte[]>(length);
+    if (!GetLogicalProcessorInformationEx(RelationAll, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.get()), &length))
+        return false;
+
+    std::vector<NUMA_NODE_RELATIONSHIP> nodes {};
+
+    for (DWORD offset = 0; offset < length;)
+    {
+        auto const* info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.get() + offset);
+
+        if (info->Relationship == RelationProcessorCore)
+        {
+            for (WORD group = 0; group < info->Processor.GroupCount; ++group)
+            {
+                GROUP_AFFINITY const& mask = info->Processor.GroupMask[group];
+
+                for (RkUint32 number = 0U; number < sizeof(KAFFINITY) * 8U; ++number)
+                {
+                    if (mask.Mask & (KAFFINITY {1} << number))
+                        m_processors.push_back({.group = mask.Group, .number = number, .core = m_cores_count});
+                }
+            }
+
+            ++m_cores_count;
+        }
+
+        else if (info->Relationship == RelationNumaNode)
+            nodes.push_back(info->NumaNode);
+
+        offset += info->Size;
+    }
+
+    for (LogicalProcessor& processor: m_processors)
+    {
+        for (NUMA_NODE_RELATIONSHIP const& node: nodes)
+        {
+            if (node.GroupMask.Group == processor.group && (node.GroupMask.Mask & (KAFFINITY {1} << processor.number)))
+                processor.numa_node = node.NodeNumber;
+        }
+    }
+
+    // Only keeping the processors of the process affinity mask, if it lies in a single group
+    DWORD_PTR process_mask = 0;
+    DWORD_PTR system_mask  = 0;
+    USHORT    group        = 0;
+    USHORT    group_count  = 1;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask) &&
+        GetProcessGroupAffinity(GetCurrentProcess(), &group_count, &group) && group_count == 1)
+    {
+        std::erase_if(m_processors, [=](LogicalProcessor const& in_processor) {
+            return in_processor.group != group || !(process_mask & (DWORD_PTR {1} << in_processor.number));
+        });
+    }
+
+    return true;
+}
+
+#elif defined(RUKEN_OS_LINUX)
+
+RkBool CpuTopology::QueryProcessors() noexcept
+{
+    // Parses a sysfs cpu list, like "0-3,8-11"
+    auto const parse_list = [](std::string const& in_path) {
+        std::vector<RkUint32> cpus {};
+        std::ifstream         file (in_path);
+        std::string           range;
+
+        while (std::getline(file, range, ','))
+        {
+            RkUint32 first = 0U;
+            RkUint32 last  = 0U;
+            RkInt    const parsed = std::sscanf(range.c_str(), "%u-%u", &first, &last);
+
+            if (parsed < 1)
+                break;
+
+            for (RkUint32 cpu = first; cpu <= (parsed == 2 ? last : first); ++cpu)
+                cpus.push_back(cpu);
+        }
+
+        return cpus;
+    };
+
+    auto const read_value = [](std::string const& in_path) {
+        RkUint32      value = 0U;
+        std::ifstream file (in_path);
+        file >> value;
+
+        return value;
+    };
+
+    std::vector<RkUint32> const cpus = parse_list("/sys/devices/system/cpu/online");
+    if (cpus.empty())
+        return false;
+
+    cpu_set_t process_mask;
+    CPU_ZERO(&process_mask);
+    RkBool const has_mask = sched_getaffinity(0, sizeof(process_mask), &process_mask) == 0;
+
+    // Cores are identified by their package and their core id in the package
+    std::map<RkUint64, RkUint32> cores {};
+
+    for (RkUint32 const cpu: cpus)
+    {
+        if (has_mask && !CPU_ISSET(cpu, &process_mask))
+            continue;
+
+        std::string const topology = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+        RkUint64    const core_key = static_cast<RkUint64>(read_value(topology + "physical_package_id")) << 32ULL |
+                                     read_value(topology + "core_id");
+
+        RkUint32 const core = cores.try_emplace(core_key, static_cast<RkUint32>(cores.size())).first->second;
+
+        m_processors.push_back({.number = cpu, .core = core});
+    }
+
+    m_cores_count = static_cast<RkUint32>(cores.size());
+
+    // Numa nodes, missing on kernels built without numa support
+    for (RkUint32 const node: parse_list("/sys/devices/system/node/online"))
+    {
+        for (RkUint32 const cpu: parse_list("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"))
+        {
+            for (LogicalProcessor& processor: m_processors)
+            {
+                if (processor.number == cpu)
+                    processor.numa_node = node;
+            }
+        }
+    }
+
+    return true;
+}
+
+#else
+
+RkBool CpuTopology::QueryProcessors() noexcept
+{
+    return false;
+}
+
+#endif
+
+RkVoid CpuTopology::Normalize() noexcept
+{
+    // Making the numa node indices contiguous, some might be missing or empty
+    std::map<RkUint32, RkUint32> nodes {};
+    for (LogicalProcessor const& processor: m_processors)
+        nodes.try_emplace(processor.numa_node, 0U);
+
+    RkUint32 node_index = 0U;
+    for (auto& [node, index]: nodes)
+        index = node_index++;
+
+    m_numa_nodes_count = std::max(node_index, 1U);
+
+    // Same thing for the cores, then the SMT index is the number of processors already seen on the same core
+    std::map<RkUint32, RkUint32> cores      {};
+    std::map<RkUint32, RkUint32> smt_counts {};
+    for (LogicalProcessor& processor: m_processors)
+    {
+        processor.numa_node = nodes[processor.numa_node];
+        processor.core      = cores.try_emplace(processor.core, static_cast<RkUint32>(cores.size())).first->second;
+        processor.smt_index = smt_counts[processor.core]++;
+    }
+
+    m_cores_count = static_cast<RkUint32>(cores.size());
+}
+
+std::vector<LogicalProcessor> const& CpuTopology::GetLogicalProcessors() const noexcept
+{
+    return m_processors;
+}
+
+RkUint32 CpuTopology::GetCoresCount() const noexcept
+{
+    return m_cores_count;
+}
+
+RkUint32 CpuTopology::GetNumaNodesCount() const noexcept
+{
+    return m_numa_nodes_count;
+}
+
+std::vector<LogicalProcessor> CpuTopology::GetPlacementOrder(RkBool const in_skip_smt_siblings) const noexcept
+{
+    std::vector<LogicalProcessor> order {};
+    order.reserve(m_processors.size());
+
+    for (LogicalProcessor const& processor: m_processors)
+    {
+        if (!in_skip_smt_siblings || processor.smt_index == 0U)
+            order.push_back(processor);
+    }
+
+    std::ranges::stable_sort(order, [](LogicalProcessor const& in_lhs, LogicalProcessor const& in_rhs) {
+        if (in_lhs.numa_node != in_rhs.numa_node)
+            return in_lhs.numa_node < in_rhs.numa_node;
+
+        if (in_lhs.smt_index != in_rhs.smt_index)
+            return in_lhs.smt_index < in_rhs.smt_index;
+
+        return in_lhs.core < in_rhs.core;
+    });
+
+    return order;
+}
@@ -0,0 +1,122 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include "Threading/Event.hpp"
+#include "Threading/Futex.hpp"
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Constructors
+
+Event::Event(EEventResetMode const in_reset_mode, RkBool const in_signaled) noexcept:
+    m_reset_mode {in_reset_mode},
+    m_state      {in_signaled ? signaled_bit : 0U}
+{}
+
+#pragma endregion
+
+#pragma region Methods
+
+RkBool Event::TryAcquire(RkUint32& io_state) noexcept
+{
+    while (io_state & signaled_bit)
+    {
+        if (m_reset_mode == EEventResetMode::Manual)
+            return true;
+
+        // Consuming the signal, the waiters count is left untouched
+        if (m_state.compare_exchange_weak(io_state, io_state & ~signaled_bit, std::memory_order_acquire, std::memory_order_relaxed))
+            return true;
+    }
+
+    return false;
+}
+
+RkVoid Event::Set() noexcept
+{
+    RkUint32 const state = m_state.fetch_or(signaled_bit, std::memory_order_release);
+
+    // The waiting threads have already been woken up if the event was already set
+    if ((state & signaled_bit) || state < waiter_unit)
+        return;
+
+    if (m_reset_mode == EEventResetMode::Manual)
+        Futex::WakeAll(m_state);
+    else
+        Futex::WakeOne(m_state);
+}
+
+RkVoid Event::Reset() noexcept
+{
+    m_state.fetch_and(~signaled_bit, std::memory_order_relaxed);
+}
+
+RkBool Event::IsSet() const noexcept
+{
+    return m_state.load(std::memory_order_acquire) & signaled_bit;
+}
+
+RkBool Event::TryWait() noexcept
+{
+    RkUint32 state = m_state.load(std::memory_order_acquire);
+
+    return TryAcquire(state);
+}
+
+RkVoid Event::Wait() noexcept
+{
+    (RkVoid)WaitUntil(std::chrono::steady_clock::time_point::max());
+}
+
+RkBool Event::WaitFor(std::chrono::nanoseconds const in_timeout) noexcept
+{
+    return WaitUntil(std::chrono::steady_clock::now() + in_timeout);
+}
+
+RkBool Event::WaitUntil(std::chrono::steady_clock::time_point const in_deadline) noexcept
+{
+    RkUint32 state = m_state.load(std::memory_order_acquire);
+
+    if (TryAcquire(state))
+        return true;
+
+    // Registering as a waiter so that Set() knows it has to wake someone up
+    state = m_state.fetch_add(waiter_unit, std::memory_order_acquire) + waiter_unit;
+
+    RkBool released = false;
+
+    while (!(released = TryAcquire(state)))
+    {
+        if (!Futex::WaitUntil(m_state, state, in_deadline))
+            break;
+
+        state = m_state.load(std::memory_order_acquire);
+    }
+
+    m_state.fetch_sub(waiter_unit, std::memory_order_relaxed);
+
+    return released;
+}
+
+#pragma endregion
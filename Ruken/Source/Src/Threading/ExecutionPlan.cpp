@@ -22,90 +22,311 @@
  *  SOFTWARE.
  */
 
-#include <latch>
+#include "Meta/Assert.hpp"
 
 #include "Threading/Scheduler.hpp"
 #include "Threading/ExecutionPlan.hpp"
+#include "Debug/Tracing/TraceScope.hpp"
 
 USING_RUKEN_NAMESPACE
 
+RkVoid ExecutionPlan::CompilePlan() noexcept
+{
+    RkSize const nodes_count = m_nodes.size();
+
+    // Counting the edges of every node, then laying out the successors contiguously (sorted by predecessor)
+    for (Node& node: m_nodes)
+    {
+        node.predecessors_count = 0ULL;
+        node.successors_count   = 0ULL;
+    }
+
+    for (auto const& [predecessor, successor]: m_edges)
+    {
+        ++m_nodes[predecessor].successors_count;
+        ++m_nodes[successor]  .predecessors_count;
+    }
+
+    RkSize offset = 0ULL;
+    for (Node& node: m_nodes)
+    {
+        node.successors_offset = offset;
+        offset += node.successors_count;
+        node.successors_count  = 0ULL;
+    }
+
+    m_successors.resize(m_edges.size());
+    for (auto const& [predecessor, successor]: m_edges)
+    {
+        Node& node = m_nodes[predecessor];
+        m_successors[node.successors_offset + node.successors_count++] = successor;
+    }
+
+    m_roots.clear();
+    for (RkSize index = 0ULL; index < nodes_count; ++index)
+    {
+        if (m_nodes[index].predecessors_count == 0ULL)
+            m_roots.emplace_back(index);
+    }
+
+    m_pending_predecessors = std::make_unique<std::atomic<RkSize>[]>(nodes_count);
+    m_ready_tokens         = std::make_unique<CompletionToken[]>    (nodes_count);
+    m_compiled             = true;
+}
+
+RkBool ExecutionPlan::RequiresExecution(Node const& in_node) noexcept
+{
+    return in_node.instruction && !(in_node.skip && in_node.skip(in_node.skip_context));
+}
+
+RkVoid ExecutionPlan::ScheduleNode(RkSize const in_node) noexcept
+{
+    // Join nodes and skipped nodes have nothing to execute, there is no need to go through the scheduler
+    if (!RequiresExecution(m_nodes[in_node]))
+        ExecuteNode(in_node, false);
+    else
+        m_scheduler->ScheduleTask([this, in_node] { ExecuteNode(in_node, true); }, EJobPriority::Critical);
+}
+
+RkVoid ExecutionPlan::ExecuteNode(RkSize in_node, RkBool in_execute) noexcept
+{
+    while (in_node != invalid_node)
+    {
+        Node const& node = m_nodes[in_node];
+
+        if (in_execute)
+        {
+            RUKEN_TRACE_SCOPE(node.name, "ExecutionPlan")
+
+            node.instruction();
+        }
+
+        // Releasing the successors, the first one that became ready is kept
+        // to be executed right away by this thread, others are pushed to the scheduler
+        RkSize continuation = invalid_node;
+        for (RkSize index = node.successors_offset; index < node.successors_offset + node.successors_count; ++index)
+        {
+            RkSize const successor = m_successors[index];
+
+            if (m_pending_predecessors[successor].fetch_sub(1ULL, std::memory_order_acq_rel) != 1ULL)
+                continue;
+
+            // In deterministic mode, instructions are only released by the thread executing the plan, see ReleaseInOrder()
+            if (m_releases_in_order && m_nodes[successor].instruction)
+            {
+                m_ready_tokens[successor].Complete();
+                continue;
+            }
+
+            if (continuation == invalid_node)
+                continuation = successor;
+            else
+                ScheduleNode(successor);
+        }
+
+        // The last node to complete wakes up the thread waiting for the plan
+        m_remaining_nodes.Complete();
+
+        in_node = continuation;
+
+        if (in_node != invalid_node)
+            in_execute = RequiresExecution(m_nodes[in_node]);
+    }
+}
+
+RkVoid ExecutionPlan::ReleaseInOrder(Scheduler& in_scheduler) noexcept
+{
+    for (RkSize index = 0ULL; index < m_nodes.size(); ++index)
+    {
+        if (m_nodes[index].instruction && m_nodes[index].predecessors_count != 0ULL)
+            m_ready_tokens[index].Add();
+    }
+
+    // Join nodes are never released, these are completed by their last predecessor
+    for (RkSize const root: m_roots)
+    {
+        if (!m_nodes[root].instruction)
+            ExecuteNode(root, false);
+    }
+
+    // The recorded order is topological, the predecessors of every instruction have thus already been released.
+    // The calling thread executes jobs while an instruction is not ready yet
+    for (RkSize const node: m_execution_order)
+    {
+        in_scheduler.Wait(m_ready_tokens[node]);
+
+        ScheduleNode(node);
+    }
+}
+
+RkVoid ExecutionPlan::BuildExecutionOrder(RkUint64 in_seed) noexcept
+{
+    // SplitMix64, the sequence only depends on the seed, on every platform
+    auto const next_random = [&in_seed] {
+        RkUint64 value = (in_seed += 0x9E3779B97F4A7C15ULL);
+
+        value = (value ^ (value >> 30ULL)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27ULL)) * 0x94D049BB133111EBULL;
+
+        return value ^ (value >> 31ULL);
+    };
+
+    m_execution_order.clear();
+    m_ready_nodes    .assign(m_roots.begin(), m_roots.end());
+
+    for (RkSize index = 0ULL; index < m_nodes.size(); ++index)
+        m_pending_predecessors[index].store(m_nodes[index].predecessors_count, std::memory_order_relaxed);
+
+    // Kahn's algorithm, picking a random node among the ready ones every time
+    while (!m_ready_nodes.empty())
+    {
+        RkSize const picked = next_random() % m_ready_nodes.size();
+        RkSize const node   = m_ready_nodes[picked];
+
+        m_ready_nodes[picked] = m_ready_nodes.back();
+        m_ready_nodes.pop_back();
+
+        // Join nodes are not part of the record, these have nothing to execute
+        if (m_nodes[node].instruction)
+            m_execution_order.emplace_back(node);
+
+        for (RkSize index = m_nodes[node].successors_offset; index < m_nodes[node].successors_offset + m_nodes[node].successors_count; ++index)
+        {
+            RkSize const successor = m_successors[index];
+
+            if (m_pending_predecessors[successor].fetch_sub(1ULL, std::memory_order_relaxed) == 1ULL)
+                m_ready_nodes.emplace_back(successor);
+        }
+    }
+}
+
 RkVoid ExecutionPlan::ResetPlan() noexcept
 {
-    m_current_pack_size = 0;
+    m_current_pack.clear();
+    m_pack_join = invalid_node;
+
+    m_edges     .clear();
+    m_nodes     .clear();
+    m_successors.clear();
+    m_roots     .clear();
 
-    m_packs       .clear();
-    m_instructions.clear();
+    m_execution_order.clear();
+    m_executions_count = 0ULL;
+
+    m_compiled = false;
 }
 
-RkVoid ExecutionPlan::AddInstruction(Job&& in_instruction) noexcept
+RkSize ExecutionPlan::AddInstruction(Job&&               in_instruction,
+                                     RkChar const*       in_name,
+                                     SkipPredicate const in_skip,
+                                     RkVoid*       const in_skip_context) noexcept
 {
+    RkSize const node = m_nodes.size();
+
     // Adding the new instruction
-    m_instructions.emplace_back(std::forward<Job>(in_instruction));
+    Node& new_node = m_nodes.emplace_back();
+    new_node.instruction  = std::move(in_instruction);
+    new_node.name         = in_name;
+    new_node.skip         = in_skip;
+    new_node.skip_context = in_skip_context;
+
+    m_current_pack.emplace_back(node);
+    m_compiled = false;
 
-    // Increasing the pack size
-    m_current_pack_size++;
+    // The instruction can only start once the previous pack is done
+    if (m_pack_join != invalid_node)
+        m_edges.emplace_back(m_pack_join, node);
+
+    return node;
+}
+
+RkVoid ExecutionPlan::AddDependency(RkSize const in_predecessor, RkSize const in_successor) noexcept
+{
+    // Nodes are always executed in index order by ExecutePlanSynchronously(), a misordered dependency
+    // cannot be honored and would silently turn into a data race between the two instructions
+    RUKEN_ASSERT_MESSAGE(in_successor < m_nodes.size(), "The successor instruction does not exist");
+    RUKEN_ASSERT_MESSAGE(in_predecessor < in_successor, "Instructions can only depend on previously added instructions");
+
+    m_edges.emplace_back(in_predecessor, in_successor);
+    m_compiled = false;
 }
 
 RkVoid ExecutionPlan::EndInstructionPack() noexcept
 {
     // If there is no pack to wrap up, returning
-    if (m_current_pack_size == 0ULL)
+    if (m_current_pack.empty())
         return;
 
-    m_packs.emplace_back(m_current_pack_size);
-    m_current_pack_size = 0ULL;
+    // Joining the whole pack into a single node, this way, a pack of n instructions
+    // followed by a pack of m instructions only requires n + m edges instead of n * m
+    m_pack_join = m_nodes.size();
+    m_nodes.emplace_back();
+
+    for (RkSize const node: m_current_pack)
+        m_edges.emplace_back(node, m_pack_join);
+
+    m_current_pack.clear();
+    m_compiled = false;
 }
 
-RkVoid ExecutionPlan::ExecutePlanAsynchronously(Scheduler& in_scheduler) const noexcept
+RkVoid ExecutionPlan::ExecutePlanAsynchronously(Scheduler& in_scheduler) noexcept
 {
-    std::vector<std::latch*> latches {m_packs.size()};
+    RUKEN_TRACE_SCOPE("Execute plan", "ExecutionPlan")
+
+    if (!m_compiled)
+        CompilePlan();
+
+    // Nothing to execute, this happens when no system of an entity admin is enabled
+    if (m_nodes.empty())
+        return;
+
+    m_releases_in_order = in_scheduler.IsDeterministic();
+
+    // Every execution gets its own order, replaying the same seed replays the same sequence of orders
+    if (m_releases_in_order)
+        BuildExecutionOrder(in_scheduler.GetDeterministicSeed() ^ (m_executions_count++ * 0xD1B54A32D192ED03ULL));
 
-    // Creating the latches
-    for (RkSize pack: m_packs)
-        latches.emplace_back(new std::latch(pack));
+    // Resetting the counters, the scheduling of the roots publishes these to the workers
+    for (RkSize index = 0ULL; index < m_nodes.size(); ++index)
+        m_pending_predecessors[index].store(m_nodes[index].predecessors_count, std::memory_order_relaxed);
 
-    // Creating the jobs
-    RkSize instruction_index = 0ULL;
+    m_remaining_nodes.Add(static_cast<RkUint32>(m_nodes.size()));
+    m_scheduler = &in_scheduler;
 
-    for(RkSize pack_index = 0ULL; pack_index < m_packs.size(); ++pack_index)
+    if (m_releases_in_order)
+        ReleaseInOrder(in_scheduler);
+
+    else
     {
-        RkSize const pack_end = instruction_index + m_packs[pack_index];
+        for (RkSize const root: m_roots)
+            ScheduleNode(root);
+    }
+
+    // Waiting for the last node to be executed, ie. waiting for the plan to be executed.
+    // The calling thread executes the instructions as well in the meantime
+    in_scheduler.Wait(m_remaining_nodes);
+}
 
-        for(;instruction_index < pack_end; ++instruction_index)
+RkVoid ExecutionPlan::ExecutePlanSynchronously() const noexcept
+{
+    // Nodes only depend on previous nodes, the insertion order is thus a valid execution order
+    for (Node const& node: m_nodes)
+    {
+        if (RequiresExecution(node))
         {
-            // FIXME: Scheduling every job right away
-            //
-            // This will consume every threads of the thread pool at once if there are more instructions than threads
-            // This might be a problem later on since some threads are consumed
-            // to wait other instructions, resulting in a potential stall if anything else needs to be executed asynchronously in the same time
-            in_scheduler.ScheduleTask([this, &latches, pack_index, instruction_index] {
-
-                // Waiting for the previous instruction pack to be done
-                // (If there is one)
-                if (pack_index > 0)
-                    latches[pack_index - 1]->wait();
-
-                // Executing the current instruction
-                m_instructions[instruction_index]();
-
-                // Notifying the pack that one instruction has been done
-                // If the pack is completed, this will allow the next pack to start execution
-                latches[pack_index]->count_down();
-            });
+            RUKEN_TRACE_SCOPE(node.name, "ExecutionPlan")
+
+            node.instruction();
         }
     }
+}
 
-    // Waiting for the last instruction pack to be executed
-    // ie. waiting for the plan to be executed
-    latches[latches.size() - 1]->wait();
-
-    for(std::latch* latch: latches)
-        delete latch;
+std::vector<RkSize> const& ExecutionPlan::GetExecutionOrder() const noexcept
+{
+    return m_execution_order;
 }
 
-RkVoid ExecutionPlan::ExecutePlanSynchronously() const noexcept
+RkChar const* ExecutionPlan::GetInstructionName(RkSize const in_instruction) const noexcept
 {
-    // Synchronous execution of the plan
-    for (auto&& instruction: m_instructions)
-        instruction();
+    return m_nodes[in_instruction].name;
 }
@@ -0,0 +1,121 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include "Build/OperatingSystem.hpp"
+
+#include "Threading/Futex.hpp"
+
+#if defined(RUKEN_OS_WINDOWS)
+    #include "Utility/WindowsOS.hpp"
+#elif defined(RUKEN_OS_LINUX)
+    #include <cerrno>
+    #include <climits>
+    #include <ctime>
+    #include <unistd.h>
+    #include <sys/syscall.h>
+    #include <linux/futex.h>
+#else
+    #include <thread>
+#endif
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Methods
+
+#if defined(RUKEN_OS_WINDOWS)
+
+RkBool Futex::WaitOnWord(RkVoid const* in_address, RkUint32 in_expected, RkInt64 const in_timeout) noexcept
+{
+    // Rounding the timeout up, a 0ms wait would turn timed waits into spin loops
+    DWORD const milliseconds = in_timeout < 0LL ? INFINITE : static_cast<DWORD>((in_timeout + 999'999LL) / 1'000'000LL);
+
+    if (WaitOnAddress(const_cast<RkVoid*>(in_address), &in_expected, sizeof(RkUint32), milliseconds))
+        return true;
+
+    return GetLastError() != ERROR_TIMEOUT;
+}
+
+RkVoid Futex::WakeWord(RkVoid const* in_address, RkBool const in_wake_all) noexcept
+{
+    if (in_wake_all)
+        WakeByAddressAll(const_cast<RkVoid*>(in_address));
+    else
+        WakeByAddressSingle(const_cast<RkVoid*>(in_address));
+}
+
+#elif defined(RUKEN_OS_LINUX)
+
+RkBool Futex::WaitOnWord(RkVoid const* in_address, RkUint32 const in_expected, RkInt64 const in_timeout) noexcept
+{
+    timespec  timeout     {};
+    timespec* timeout_ptr {nullptr};
+
+    // FUTEX_WAIT takes a relative timeout, measured against the monotonic clock
+    if (in_timeout >= 0LL)
+    {
+        timeout.tv_sec  = static_cast<time_t>(in_timeout / 1'000'000'000LL);
+        timeout.tv_nsec = static_cast<long>  (in_timeout % 1'000'000'000LL);
+        timeout_ptr     = &timeout;
+    }
+
+    if (syscall(SYS_futex, in_address, FUTEX_WAIT_PRIVATE, in_expected, timeout_ptr, nullptr, 0) == 0)
+        return true;
+
+    // EAGAIN means that the word didn't hold the expected value anymore, EINTR is a spurious wake up
+    return errno != ETIMEDOUT;
+}
+
+RkVoid Futex::WakeWord(RkVoid const* in_address, RkBool const in_wake_all) noexcept
+{
+    syscall(SYS_futex, in_address, FUTEX_WAKE_PRIVATE, in_wake_all ? INT_MAX : 1, nullptr, nullptr, 0);
+}
+
+#else
+
+RkBool Futex::WaitOnWord(RkVoid const* in_address, RkUint32 const in_expected, RkInt64 const in_timeout) noexcept
+{
+    // No native support, polling the word instead
+    auto const* word     = static_cast<std::atomic<RkUint32> const*>(in_address);
+    auto const  deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(in_timeout);
+
+    while (word->load(std::memory_order_acquire) == in_expected)
+    {
+        if (in_timeout >= 0LL && std::chrono::steady_clock::now() >= deadline)
+            return false;
+
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+RkVoid Futex::WakeWord(RkVoid const* in_address, RkBool const in_wake_all) noexcept
+{
+    (RkVoid)in_address;
+    (RkVoid)in_wake_all;
+}
+
+#endif
+
+#pragma endregion
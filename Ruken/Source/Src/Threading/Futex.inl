@@ -0,0 +1,63 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+template <FutexWordType TType>
+RkVoid Futex::Wait(std::atomic<TType> const& in_word, TType const in_expected) noexcept
+{
+    (RkVoid)WaitOnWord(&in_word, std::bit_cast<RkUint32>(in_expected), -1LL);
+}
+
+template <FutexWordType TType>
+RkBool Futex::WaitFor(std::atomic<TType> const& in_word, TType const in_expected, std::chrono::nanoseconds const in_timeout) noexcept
+{
+    if (in_timeout <= std::chrono::nanoseconds::zero())
+        return false;
+
+    return WaitOnWord(&in_word, std::bit_cast<RkUint32>(in_expected), in_timeout.count());
+}
+
+template <FutexWordType TType>
+RkBool Futex::WaitUntil(std::atomic<TType> const& in_word, TType const in_expected, std::chrono::steady_clock::time_point const in_deadline) noexcept
+{
+    if (in_deadline == std::chrono::steady_clock::time_point::max())
+    {
+        Wait(in_word, in_expected);
+
+        return true;
+    }
+
+    return WaitFor(in_word, in_expected, in_deadline - std::chrono::steady_clock::now());
+}
+
+template <FutexWordType TType>
+RkVoid Futex::WakeOne(std::atomic<TType> const& in_word) noexcept
+{
+    WakeWord(&in_word, false);
+}
+
+template <FutexWordType TType>
+RkVoid Futex::WakeAll(std::atomic<TType> const& in_word) noexcept
+{
+    WakeWord(&in_word, true);
+}
@@ -0,0 +1,93 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include "Threading/Job.hpp"
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Constructors
+
+Job::Job(Job&& in_move) noexcept:
+    m_invoker {in_move.m_invoker},
+    m_manager {in_move.m_manager}
+{
+    if (m_manager)
+        m_manager(m_storage, in_move.m_storage);
+
+    in_move.m_invoker = nullptr;
+    in_move.m_manager = nullptr;
+}
+
+Job::~Job() noexcept
+{
+    Reset();
+}
+
+#pragma endregion
+
+#pragma region Methods
+
+RkVoid Job::Reset() noexcept
+{
+    if (m_manager)
+        m_manager(nullptr, m_storage);
+
+    m_invoker = nullptr;
+    m_manager = nullptr;
+}
+
+#pragma endregion
+
+#pragma region Operators
+
+RkVoid Job::operator()() const noexcept
+{
+    m_invoker(m_storage);
+}
+
+Job::operator bool() const noexcept
+{
+    return m_invoker != nullptr;
+}
+
+Job& Job::operator=(Job&& in_move) noexcept
+{
+    if (this == &in_move)
+        return *this;
+
+    Reset();
+
+    if (in_move.m_manager)
+        in_move.m_manager(m_storage, in_move.m_storage);
+
+    m_invoker = in_move.m_invoker;
+    m_manager = in_move.m_manager;
+
+    in_move.m_invoker = nullptr;
+    in_move.m_manager = nullptr;
+
+    return *this;
+}
+
+#pragma endregion
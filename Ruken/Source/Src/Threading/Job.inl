@@ -0,0 +1,62 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma region Methods
+
+template <typename TCallable>
+RkVoid Job::Invoke(RkVoid* in_storage) noexcept
+{
+    (*static_cast<TCallable*>(in_storage))();
+}
+
+template <typename TCallable>
+RkVoid Job::Manage(RkVoid* in_destination, RkVoid* in_source) noexcept
+{
+    TCallable* source = static_cast<TCallable*>(in_source);
+
+    if (in_destination)
+        new (in_destination) TCallable(std::move(*source));
+
+    source->~TCallable();
+}
+
+#pragma endregion
+
+#pragma region Constructors
+
+template <typename TCallable> requires (!std::same_as<std::remove_cvref_t<TCallable>, Job> && std::invocable<std::remove_cvref_t<TCallable>&>)
+Job::Job(TCallable&& in_callable) noexcept:
+    m_invoker {&Invoke<std::remove_cvref_t<TCallable>>},
+    m_manager {&Manage<std::remove_cvref_t<TCallable>>}
+{
+    using Callable = std::remove_cvref_t<TCallable>;
+
+    static_assert(sizeof (Callable) <= storage_size, "The callable is too big to be stored in a job, consider capturing a pointer to your data instead");
+    static_assert(alignof(Callable) <= 16ULL,        "The callable is over-aligned and cannot be stored in a job");
+    static_assert(std::is_nothrow_move_constructible_v<Callable>, "The callable of a job must be nothrow move constructible");
+
+    new (m_storage) Callable(std::forward<TCallable>(in_callable));
+}
+
+#pragma endregion
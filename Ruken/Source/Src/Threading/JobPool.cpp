@@ -0,0 +1,77 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include "Build/Config.hpp"
+#include "Threading/JobPool.hpp"
+
+USING_RUKEN_NAMESPACE
+
+JobPool::JobPool(RkSize const in_capacity) noexcept
+{
+    RkSize capacity = 1ULL;
+    while (capacity < in_capacity)
+        capacity <<= 1;
+
+    m_ring = std::make_unique<PooledJob[]>(capacity);
+    m_mask = capacity - 1ULL;
+}
+
+PooledJob* JobPool::Acquire(Job&& in_job, CompletionToken* in_token) noexcept
+{
+    for (RkSize probe = 0ULL; probe < RUKEN_JOB_POOL_PROBE_COUNT; ++probe)
+    {
+        PooledJob& pooled_job = m_ring[m_cursor++ & m_mask];
+
+        // Synchronizes with the release of the job, the previous callable is guaranteed to be destroyed
+        if (pooled_job.busy.load(std::memory_order_acquire))
+            continue;
+
+        pooled_job.job   = std::move(in_job);
+        pooled_job.token = in_token;
+        pooled_job.busy.store(true, std::memory_order_relaxed);
+
+        return &pooled_job;
+    }
+
+    // Too many jobs in flight, falling back on the heap
+    PooledJob* heap_job = new PooledJob();
+
+    heap_job->job    = std::move(in_job);
+    heap_job->token  = in_token;
+    heap_job->pooled = false;
+
+    return heap_job;
+}
+
+RkVoid JobPool::Release(PooledJob* in_job) noexcept
+{
+    if (!in_job->pooled)
+    {
+        delete in_job;
+        return;
+    }
+
+    in_job->job.Reset();
+    in_job->busy.store(false, std::memory_order_release);
+}
@@ -0,0 +1,84 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include "Threading/Latch.hpp"
+#include "Threading/Futex.hpp"
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Constructors
+
+Latch::Latch(RkUint32 const in_count) noexcept:
+    m_count {in_count}
+{}
+
+#pragma endregion
+
+#pragma region Methods
+
+RkVoid Latch::CountDown(RkUint32 const in_count) noexcept
+{
+    // A latch only reaches zero once, so this is at most one system call per latch
+    if (m_count.fetch_sub(in_count, std::memory_order_release) == in_count)
+        Futex::WakeAll(m_count);
+}
+
+RkVoid Latch::ArriveAndWait(RkUint32 const in_count) noexcept
+{
+    CountDown(in_count);
+    Wait();
+}
+
+RkUint32 Latch::GetCount() const noexcept
+{
+    return m_count.load(std::memory_order_relaxed);
+}
+
+RkBool Latch::TryWait() const noexcept
+{
+    return m_count.load(std::memory_order_acquire) == 0U;
+}
+
+RkVoid Latch::Wait() const noexcept
+{
+    (RkVoid)WaitUntil(std::chrono::steady_clock::time_point::max());
+}
+
+RkBool Latch::WaitFor(std::chrono::nanoseconds const in_timeout) const noexcept
+{
+    return WaitUntil(std::chrono::steady_clock::now() + in_timeout);
+}
+
+RkBool Latch::WaitUntil(std::chrono::steady_clock::time_point const in_deadline) const noexcept
+{
+    for (RkUint32 count = m_count.load(std::memory_order_acquire); count != 0U; count = m_count.load(std::memory_order_acquire))
+    {
+        if (!Futex::WaitUntil(m_count, count, in_deadline))
+            return m_count.load(std::memory_order_acquire) == 0U;
+    }
+
+    return true;
+}
+
+#pragma endregion
@@ -0,0 +1,41 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <algorithm>
+
+#include "Threading/ParallelAlgorithms.hpp"
+
+USING_RUKEN_NAMESPACE
+
+RkSize RUKEN_NAMESPACE::GetParallelChunksCount(Scheduler const& in_scheduler, RkSize const in_elements_count) noexcept
+{
+    // The partitioning must not depend on the machine in deterministic mode
+    if (in_scheduler.IsDeterministic())
+        return std::clamp<RkSize>(RUKEN_PARALLEL_DETERMINISTIC_CHUNKS_COUNT, 1ULL, std::max<RkSize>(in_elements_count, 1ULL));
+
+    // Workers and the calling thread
+    RkSize const threads_count = in_scheduler.GetWorkers().size() + 1ULL;
+
+    return std::clamp<RkSize>(threads_count * RUKEN_PARALLEL_CHUNKS_PER_THREAD, 1ULL, std::max<RkSize>(in_elements_count, 1ULL));
+}
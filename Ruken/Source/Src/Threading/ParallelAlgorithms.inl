@@ -0,0 +1,233 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma region ParallelForContext
+
+template <typename TFunction>
+ParallelForContext<TFunction>::ParallelForContext(TFunction& in_function, Scheduler& in_scheduler, RkSize const in_grain_size) noexcept:
+    m_function      {in_function},
+    m_scheduler     {in_scheduler},
+    m_grain_size    {in_grain_size},
+    m_deterministic {in_scheduler.IsDeterministic()}
+{}
+
+template <typename TFunction>
+RkVoid ParallelForContext<TFunction>::Execute(RkSize in_begin, RkSize in_end) noexcept
+{
+    while (in_begin < in_end)
+    {
+        RkSize const size = in_end - in_begin;
+
+        // Giving away the right half of the range if someone could pick it up
+        if (size > m_grain_size && (m_deterministic || m_scheduler.HasStealDemand()))
+        {
+            RkSize const middle = in_begin + size / 2ULL;
+
+            m_scheduler.ScheduleTask([this, middle, in_end] { Execute(middle, in_end); }, m_split_jobs);
+
+            in_end = middle;
+            continue;
+        }
+
+        RkSize const grain_end = in_begin + std::min(size, m_grain_size);
+
+        m_function(in_begin, grain_end);
+        in_begin = grain_end;
+    }
+}
+
+template <typename TFunction>
+RkVoid ParallelForContext<TFunction>::Wait() noexcept
+{
+    m_scheduler.Wait(m_split_jobs);
+}
+
+#pragma endregion
+
+#pragma region Algorithms
+
+template <typename TFunction> requires std::invocable<TFunction&, RkSize, RkSize>
+RkVoid ParallelFor(Scheduler& in_scheduler, RkSize const in_begin, RkSize const in_end, TFunction&& in_function, RkSize in_grain_size) noexcept
+{
+    if (in_begin >= in_end)
+        return;
+
+    if (in_grain_size == 0ULL)
+    {
+        RkSize const chunks_count = GetParallelChunksCount(in_scheduler, in_end - in_begin);
+
+        in_grain_size = (in_end - in_begin + chunks_count - 1ULL) / chunks_count;
+    }
+
+    ParallelForContext<std::remove_reference_t<TFunction>> context(in_function, in_scheduler, in_grain_size);
+
+    context.Execute(in_begin, in_end);
+    context.Wait();
+}
+
+template <typename TValue, typename TMap, typename TCombine>
+    requires std::invocable<TMap&, RkSize, RkSize> && std::invocable<TCombine&, TValue, TValue>
+TValue ParallelReduce(Scheduler& in_scheduler, RkSize const in_begin, RkSize const in_end, TValue in_identity, TMap&& in_map, TCombine&& in_combine) noexcept
+{
+    if (in_begin >= in_end)
+        return in_identity;
+
+    RkSize const elements_count = in_end - in_begin;
+    RkSize const chunks_count   = GetParallelChunksCount(in_scheduler, elements_count);
+
+    std::vector<TValue> partials(chunks_count, in_identity);
+
+    ParallelFor(in_scheduler, 0ULL, chunks_count, [&](RkSize const in_first_chunk, RkSize const in_last_chunk) {
+        for (RkSize chunk = in_first_chunk; chunk < in_last_chunk; ++chunk)
+            partials[chunk] = in_map(in_begin + elements_count *  chunk        / chunks_count,
+                                     in_begin + elements_count * (chunk + 1ULL) / chunks_count);
+    }, 1ULL);
+
+    // Combining pair by pair along a fixed tree, independently of which thread computed what.
+    // Every round combines neighbours that are stride chunks apart, the result ends up in the first partial
+    for (RkSize stride = 1ULL; stride < chunks_count; stride *= 2ULL)
+    {
+        for (RkSize chunk = 0ULL; chunk + stride < chunks_count; chunk += 2ULL * stride)
+            partials[chunk] = in_combine(std::move(partials[chunk]), std::move(partials[chunk + stride]));
+    }
+
+    return in_combine(std::move(in_identity), std::move(partials.front()));
+}
+
+template <std::random_access_iterator TInput, std::random_access_iterator TOutput, typename TValue, typename TCombine>
+RkVoid ParallelScan(Scheduler& in_scheduler, TInput const in_first, TInput const in_last, TOutput const in_output, TValue in_identity, TCombine in_combine) noexcept
+{
+    if (in_first >= in_last)
+        return;
+
+    RkSize const elements_count = static_cast<RkSize>(in_last - in_first);
+    RkSize const chunks_count   = GetParallelChunksCount(in_scheduler, elements_count);
+
+    auto const chunk_begin = [&](RkSize const in_chunk) { return static_cast<std::iter_difference_t<TInput>>(elements_count * in_chunk / chunks_count); };
+
+    // Reducing every chunk
+    std::vector<TValue> offsets(chunks_count, in_identity);
+
+    ParallelFor(in_scheduler, 0ULL, chunks_count, [&](RkSize const in_first_chunk, RkSize const in_last_chunk) {
+        for (RkSize chunk = in_first_chunk; chunk < in_last_chunk; ++chunk)
+        {
+            TValue total = in_identity;
+            for (auto index = chunk_begin(chunk); index < chunk_begin(chunk + 1ULL); ++index)
+                total = in_combine(std::move(total), in_first[index]);
+
+            offsets[chunk] = std::move(total);
+        }
+    }, 1ULL);
+
+    // Exclusive scan of the chunk totals, giving the offset of every chunk
+    TValue running = in_identity;
+    for (TValue& offset: offsets)
+    {
+        TValue total = std::move(offset);
+        offset  = running;
+        running = in_combine(std::move(running), std::move(total));
+    }
+
+    // Scanning every chunk from its offset
+    ParallelFor(in_scheduler, 0ULL, chunks_count, [&](RkSize const in_first_chunk, RkSize const in_last_chunk) {
+        for (RkSize chunk = in_first_chunk; chunk < in_last_chunk; ++chunk)
+        {
+            TValue value = std::move(offsets[chunk]);
+            for (auto index = chunk_begin(chunk); index < chunk_begin(chunk + 1ULL); ++index)
+            {
+                value = in_combine(std::move(value), in_first[index]);
+                in_output[index] = value;
+            }
+        }
+    }, 1ULL);
+}
+
+template <std::random_access_iterator TIterator, typename TCompare>
+RkVoid ParallelSort(Scheduler& in_scheduler, TIterator const in_first, TIterator const in_last, TCompare in_compare) noexcept
+{
+    using Value      = std::iter_value_t<TIterator>;
+    using Difference = std::iter_difference_t<TIterator>;
+
+    RkSize const elements_count = in_last > in_first ? static_cast<RkSize>(in_last - in_first) : 0ULL;
+    RkSize const chunks_count   = GetParallelChunksCount(in_scheduler, elements_count / RUKEN_PARALLEL_SORT_THRESHOLD);
+
+    if (elements_count < RUKEN_PARALLEL_SORT_THRESHOLD * 2ULL || chunks_count < 2ULL)
+    {
+        std::sort(in_first, in_last, in_compare);
+        return;
+    }
+
+    auto const chunk_begin = [&](RkSize const in_chunk) {
+        return static_cast<Difference>(elements_count * std::min(in_chunk, chunks_count) / chunks_count);
+    };
+
+    // Sorting every chunk
+    ParallelFor(in_scheduler, 0ULL, chunks_count, [&](RkSize const in_first_chunk, RkSize const in_last_chunk) {
+        for (RkSize chunk = in_first_chunk; chunk < in_last_chunk; ++chunk)
+            std::sort(in_first + chunk_begin(chunk), in_first + chunk_begin(chunk + 1ULL), in_compare);
+    }, 1ULL);
+
+    // Merging sorted runs pair by pair, runs double in size every round
+    std::vector<Value> buffer(elements_count);
+
+    auto const merge_round = [&](auto const in_source, auto const in_destination, RkSize const in_run_chunks) {
+        RkSize const pairs_count = (chunks_count + 2ULL * in_run_chunks - 1ULL) / (2ULL * in_run_chunks);
+
+        ParallelFor(in_scheduler, 0ULL, pairs_count, [&](RkSize const in_first_pair, RkSize const in_last_pair) {
+            for (RkSize pair = in_first_pair; pair < in_last_pair; ++pair)
+            {
+                RkSize const chunk = pair * 2ULL * in_run_chunks;
+
+                Difference const begin  = chunk_begin(chunk);
+                Difference const middle = chunk_begin(chunk +        in_run_chunks);
+                Difference const end    = chunk_begin(chunk + 2ULL * in_run_chunks);
+
+                std::merge(std::make_move_iterator(in_source + begin),  std::make_move_iterator(in_source + middle),
+                           std::make_move_iterator(in_source + middle), std::make_move_iterator(in_source + end),
+                           in_destination + begin, in_compare);
+            }
+        }, 1ULL);
+    };
+
+    RkBool in_buffer = false;
+    for (RkSize run_chunks = 1ULL; run_chunks < chunks_count; run_chunks *= 2ULL)
+    {
+        if (in_buffer)
+            merge_round(buffer.begin(), in_first, run_chunks);
+        else
+            merge_round(in_first, buffer.begin(), run_chunks);
+
+        in_buffer = !in_buffer;
+    }
+
+    // Moving the result back into the range if the last round merged into the buffer
+    if (in_buffer)
+    {
+        ParallelFor(in_scheduler, 0ULL, elements_count, [&](RkSize const in_begin, RkSize const in_end) {
+            std::move(buffer.begin() + static_cast<Difference>(in_begin), buffer.begin() + static_cast<Difference>(in_end), in_first + static_cast<Difference>(in_begin));
+        });
+    }
+}
+
+#pragma endregion
@@ -0,0 +1,103 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include "Threading/ReadEpoch.hpp"
+
+USING_RUKEN_NAMESPACE
+
+#pragma region Constructors
+
+ReadEpoch::SlotOwner::~SlotOwner()
+{
+    if (slot)
+        slot->owned.store(false, std::memory_order_release);
+}
+
+#pragma endregion
+
+#pragma region Methods
+
+ReadEpoch::Slot& ReadEpoch::GetThreadSlot() noexcept
+{
+    if (m_thread_slot.slot)
+        return *m_thread_slot.slot;
+
+    // Reusing the slot of a thread that exited if possible
+    for (Slot* slot = m_slots.load(std::memory_order_acquire); slot; slot = slot->next)
+    {
+        RkBool owned = false;
+        if (!slot->owned.load(std::memory_order_relaxed) && slot->owned.compare_exchange_strong(owned, true, std::memory_order_acquire))
+        {
+            m_thread_slot.slot = slot;
+
+            return *slot;
+        }
+    }
+
+    // Otherwise registering a new one, slots are only ever pushed at the front of the list
+    Slot* slot = new Slot();
+    slot->next = m_slots.load(std::memory_order_relaxed);
+
+    while (!m_slots.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed));
+
+    m_thread_slot.slot = slot;
+
+    return *slot;
+}
+
+RkVoid ReadEpoch::Enter() noexcept
+{
+    if (m_thread_depth++ > 0ULL)
+        return;
+
+    // The announcement must be visible before the reader loads anything, hence the sequential consistency
+    GetThreadSlot().epoch.store(m_global_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+}
+
+RkVoid ReadEpoch::Exit() noexcept
+{
+    if (--m_thread_depth > 0ULL)
+        return;
+
+    GetThreadSlot().epoch.store(idle_epoch, std::memory_order_release);
+}
+
+RkUint64 ReadEpoch::Advance() noexcept
+{
+    return m_global_epoch.fetch_add(1ULL, std::memory_order_seq_cst);
+}
+
+RkBool ReadEpoch::IsReclaimable(RkUint64 const in_epoch) noexcept
+{
+    // A reader that announced the retirement epoch (or an older one) might still be accessing the value
+    for (Slot const* slot = m_slots.load(std::memory_order_acquire); slot; slot = slot->next)
+    {
+        if (slot->epoch.load(std::memory_order_seq_cst) <= in_epoch)
+            return false;
+    }
+
+    return true;
+}
+
+#pragma endregion
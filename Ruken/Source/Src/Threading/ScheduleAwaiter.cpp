@@ -0,0 +1,46 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include "Threading/Scheduler.hpp"
+#include "Threading/ScheduleAwaiter.hpp"
+
+USING_RUKEN_NAMESPACE
+
+ScheduleAwaiter::ScheduleAwaiter(Scheduler& in_scheduler, EJobPriority const in_priority) noexcept:
+    m_scheduler {in_scheduler},
+    m_priority  {in_priority}
+{}
+
+RkBool ScheduleAwaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+RkVoid ScheduleAwaiter::await_suspend(std::coroutine_handle<> in_handle) const noexcept
+{
+    m_scheduler.ScheduleTask([in_handle] { in_handle.resume(); }, m_priority);
+}
+
+RkVoid ScheduleAwaiter::await_resume() const noexcept
+{}
@@ -22,26 +22,105 @@
  *  SOFTWARE.
  */
 
+#include <thread>
+#include <algorithm>
+
 #include "Build/Config.hpp"
+#include "Meta/Safety.hpp"
+#include "Threading/CpuRelax.hpp"
+#include "Memory/FrameAllocator.hpp"
 #include "Threading/Scheduler.hpp"
 #include "Core/ServiceProvider.hpp"
+#include "Debug/Tracing/TraceScope.hpp"
 
 USING_RUKEN_NAMESPACE
 
-Scheduler::Scheduler(ServiceProvider& in_service_provider, RkUint16 const in_workers_count) noexcept:
-    Service<Scheduler> {in_service_provider},
-    m_workers          {in_workers_count == 0U ? std::thread::hardware_concurrency() - 1 : in_workers_count},
-    m_running          {true}
+Scheduler::Scheduler(ServiceProvider& in_service_provider, RkUint16 const in_workers_count, RkUint16 const in_max_background_workers) noexcept:
+    Scheduler(in_service_provider, SchedulerParams {
+        .workers_count          = in_workers_count,
+        .max_background_workers = in_max_background_workers
+    })
+{}
+
+Scheduler::Scheduler(ServiceProvider& in_service_provider, SchedulerParams const& in_params) noexcept:
+    Service<Scheduler>       {in_service_provider},
+    m_topology               {},
+    m_workers                {in_params.workers_count != 0U ? in_params.workers_count :
+                              std::max<RkSize>(in_params.skip_smt_siblings ? m_topology.GetCoresCount() : m_topology.GetLogicalProcessors().size(), 2ULL) - 1ULL},
+    m_pools                  {},
+    m_running                {true},
+    m_queues                 {},
+    m_injection_pool         {RUKEN_JOB_POOL_CAPACITY},
+    m_accounting             {std::make_unique<JobsAccounting[]>(m_workers.size() + 1ULL)},
+    m_max_background_workers {std::clamp<RkSize>(in_params.max_background_workers == 0U ? RUKEN_SCHEDULER_MAX_BACKGROUND_WORKERS : in_params.max_background_workers, 1ULL, m_workers.size())},
+    m_idle_spin_count        {RUKEN_SCHEDULER_IDLE_SPIN_COUNT},
+    m_idle_yield_count       {RUKEN_SCHEDULER_IDLE_YIELD_COUNT},
+    m_counters               {std::make_unique<WorkerCounters[]>(m_workers.size() + 1ULL)},
+    m_statistics_start       {WorkerCounters::GetTimestamp()}
 {
     #if defined(RUKEN_LOGGING_ENABLED)
 
-        m_logger = m_service_provider.LocateService<Logger>()->AddChild("scheduler");
-        m_logger->Info("Spawning " + std::to_string(m_workers.size()) + " workers");
+        if (Logger* root_logger = m_service_provider.LocateService<Logger>())
+        {
+            m_logger = root_logger->AddChild("scheduler");
+            m_logger->Info("Spawning " + std::to_string(m_workers.size()) + " workers, " +
+                           std::to_string(m_max_background_workers) + " of them can execute background jobs");
+        }
 
     #endif
 
-    for (Worker& worker : m_workers)
-        worker.Execute(&Scheduler::WorkersJob, this);
+    // Placing the workers numa node by numa node, leaving the first processor to the calling thread if possible
+    std::vector<LogicalProcessor> const placement       = m_topology.GetPlacementOrder(in_params.skip_smt_siblings);
+    RkSize                        const first_processor = placement.size() > m_workers.size() ? 1ULL : 0ULL;
+
+    m_workers_numa_node.assign(m_workers.size(), 0U);
+    if (in_params.pin_workers)
+    {
+        m_numa_nodes_count = m_topology.GetNumaNodesCount();
+
+        for (RkSize index = 0ULL; index < m_workers.size(); ++index)
+            m_workers_numa_node[index] = placement[(first_processor + index) % placement.size()].numa_node;
+
+        RUKEN_SAFE_LOGGER_CALL(m_logger, Info("Pinning workers on " + std::to_string(std::min(placement.size(), m_workers.size())) +
+                                              " logical processors, across " + std::to_string(m_numa_nodes_count) + " numa nodes"))
+    }
+
+    m_numa_nodes_workers.resize(m_numa_nodes_count);
+    for (RkSize index = 0ULL; index < m_workers.size(); ++index)
+        m_numa_nodes_workers[m_workers_numa_node[index]].push_back(index);
+
+    // Deques must all exist before any worker starts stealing
+    for (RkSize priority = 0ULL; priority < priorities_count; ++priority)
+    {
+        // One queue without preference, then one per numa node
+        m_injection_queues[priority].reserve(m_numa_nodes_count + 1ULL);
+        for (RkSize index = 0ULL; index <= m_numa_nodes_count; ++index)
+            m_injection_queues[priority].emplace_back(std::make_unique<JobQueue>(RUKEN_SCHEDULER_DEQUE_CAPACITY));
+
+        m_queues[priority].reserve(m_workers.size());
+        for (RkSize index = 0ULL; index < m_workers.size(); ++index)
+            m_queues[priority].emplace_back(std::make_unique<JobQueue>(RUKEN_SCHEDULER_DEQUE_CAPACITY));
+    }
+
+    m_pools.reserve(m_workers.size());
+    for (RkSize index = 0ULL; index < m_workers.size(); ++index)
+        m_pools.emplace_back(std::make_unique<JobPool>(RUKEN_JOB_POOL_CAPACITY));
+
+    for (RkSize index = 0ULL; index < m_workers.size(); ++index)
+    {
+        m_workers[index].Execute(&Scheduler::WorkersJob, this, index);
+
+        if (in_params.pin_workers && !m_workers[index].SetAffinity(placement[(first_processor + index) % placement.size()]))
+        {
+            RUKEN_SAFE_LOGGER_CALL(m_logger, Warning("Failed to pin worker " + std::to_string(index)))
+        }
+
+        if (in_params.name_workers)
+            m_workers[index].SetName("Ruken Worker " + std::to_string(index));
+    }
+
+    if (in_params.deterministic)
+        SetDeterministicMode(true, in_params.deterministic_seed);
 }
 
 Scheduler::~Scheduler()
@@ -49,12 +128,95 @@ Scheduler::~Scheduler()
     Shutdown();
 }
 
-RkVoid Scheduler::ScheduleTask(Job&& in_task) noexcept
+RkVoid Scheduler::ScheduleTask(Job&& in_task, EJobPriority const in_priority) noexcept
+{
+    if (!m_running.load(std::memory_order_acquire))
+        return;
+
+    PushJob(std::move(in_task), nullptr, in_priority, invalid_numa_node);
+}
+
+RkVoid Scheduler::ScheduleTask(Job&& in_task, CompletionToken& in_token, EJobPriority const in_priority) noexcept
 {
     if (!m_running.load(std::memory_order_acquire))
         return;
 
-    m_job_queue.Enqueue(std::forward<Job>(in_task));
+    in_token.Add();
+
+    PushJob(std::move(in_task), &in_token, in_priority, invalid_numa_node);
+}
+
+RkVoid Scheduler::ScheduleTaskOnNode(Job&& in_task, RkUint32 const in_numa_node, EJobPriority const in_priority) noexcept
+{
+    if (!m_running.load(std::memory_order_acquire))
+        return;
+
+    PushJob(std::move(in_task), nullptr, in_priority, in_numa_node);
+}
+
+RkVoid Scheduler::ScheduleTaskOnNode(Job&& in_task, RkUint32 const in_numa_node, CompletionToken& in_token, EJobPriority const in_priority) noexcept
+{
+    if (!m_running.load(std::memory_order_acquire))
+        return;
+
+    in_token.Add();
+
+    PushJob(std::move(in_task), &in_token, in_priority, in_numa_node);
+}
+
+RkVoid Scheduler::Wait(CompletionToken const& in_token) noexcept
+{
+    RUKEN_TRACE_SCOPE("Wait", "Scheduler")
+
+    while (!in_token.IsComplete())
+    {
+        if (TryExecuteWaitingJob())
+            continue;
+
+        // Nothing left to execute, the remaining jobs are being executed by other threads
+        in_token.Wait();
+    }
+}
+
+ScheduleAwaiter Scheduler::Schedule(EJobPriority const in_priority) noexcept
+{
+    return ScheduleAwaiter(*this, in_priority);
+}
+
+RkBool Scheduler::TryExecuteJob() noexcept
+{
+    RkSize worker_index = m_workers.size();
+
+    if (m_current_scheduler == this)
+        worker_index = m_current_worker_index;
+
+    // Any thread stealing needs a seed, the workers get theirs in WorkersJob()
+    else if (m_random_state == 0U)
+        m_random_state = static_cast<RkUint32>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1U;
+
+    PooledJob* job = AcquireJob(worker_index, EJobPriority::Critical);
+    if (!job)
+        job = AcquireJob(worker_index, EJobPriority::Normal);
+
+    if (!job)
+        return false;
+
+    ExecuteJob(job);
+
+    return true;
+}
+
+RkBool Scheduler::HasStealDemand() const noexcept
+{
+    if (m_sleeping_workers_count.load(std::memory_order_relaxed) > 0ULL)
+        return true;
+
+    RkSize const priority = static_cast<RkSize>(EJobPriority::Normal);
+
+    if (m_current_scheduler == this)
+        return m_queues[priority][m_current_worker_index]->GetSizeEstimate() == 0ULL;
+
+    return m_injection_queues[priority].front()->GetSizeEstimate() == 0ULL;
 }
 
 RkVoid Scheduler::WaitForQueuedTasks() noexcept
@@ -62,8 +224,25 @@ RkVoid Scheduler::WaitForQueuedTasks() noexcept
     if (!m_running.load(std::memory_order_acquire))
         return;
 
-    while (!m_job_queue.Empty())
-        std::this_thread::yield();
+    RUKEN_TRACE_SCOPE("Wait for queued tasks", "Scheduler")
+
+    while (GetUnfinishedJobsCount() > 0ULL)
+    {
+        if (TryExecuteWaitingJob())
+            continue;
+
+        // Nothing left to execute, parking until a job completes.
+        // Completers only notify if they see a waiter: either they see this thread registered,
+        // or this thread sees their completion when counting the unfinished jobs again
+        RkUint32 const epoch = m_completion_epoch.load(std::memory_order_seq_cst);
+
+        m_queued_tasks_waiters.fetch_add(1ULL, std::memory_order_seq_cst);
+
+        if (GetUnfinishedJobsCount() > 0ULL)
+            m_completion_epoch.wait(epoch, std::memory_order_seq_cst);
+
+        m_queued_tasks_waiters.fetch_sub(1ULL, std::memory_order_relaxed);
+    }
 }
 
 RkVoid Scheduler::Shutdown() noexcept
@@ -71,11 +250,163 @@ RkVoid Scheduler::Shutdown() noexcept
     if (!m_running.load(std::memory_order_acquire))
         return;
 
-    m_running.store(false, std::memory_order_release);
-    m_job_queue.Clear();
+    m_running.store(false, std::memory_order_seq_cst);
+
+    m_wake_epoch.fetch_add(1U, std::memory_order_seq_cst);
+    m_wake_epoch.notify_all();
 
     for (Worker& worker : m_workers)
-        worker.Detach();
+        worker.WaitForAvailability();
+
+    // Dropping any job left
+    PooledJob* job = nullptr;
+    for (RkSize priority = 0ULL; priority < priorities_count; ++priority)
+    {
+        std::atomic<RkUint64>& acquired_jobs = GetCurrentAccounting().acquired_jobs[priority];
+
+        for (std::unique_ptr<JobQueue>& queue: m_queues[priority])
+            while (queue->Pop(job))
+            {
+                acquired_jobs.fetch_add(1ULL, std::memory_order_release);
+                DropJob(job);
+            }
+
+        for (std::unique_ptr<JobQueue>& queue: m_injection_queues[priority])
+            while (queue->Steal(job))
+            {
+                acquired_jobs.fetch_add(1ULL, std::memory_order_release);
+                DropJob(job);
+            }
+    }
+}
+
+RkVoid Scheduler::SetIdleSpinBudget(RkUint32 const in_spin_count, RkUint32 const in_yield_count) noexcept
+{
+    m_idle_spin_count .store(in_spin_count,  std::memory_order_relaxed);
+    m_idle_yield_count.store(in_yield_count, std::memory_order_relaxed);
+}
+
+RkVoid Scheduler::SetDeterministicMode(RkBool const in_enabled, RkUint64 const in_seed) noexcept
+{
+    m_deterministic_seed.store(in_seed,    std::memory_order_relaxed);
+    m_deterministic     .store(in_enabled, std::memory_order_relaxed);
+
+    if (in_enabled)
+    {
+        RUKEN_SAFE_LOGGER_CALL(m_logger, Info("Deterministic mode enabled with seed " + std::to_string(in_seed)))
+    }
+    else
+    {
+        RUKEN_SAFE_LOGGER_CALL(m_logger, Info("Deterministic mode disabled"))
+    }
+}
+
+RkBool Scheduler::IsDeterministic() const noexcept
+{
+    return m_deterministic.load(std::memory_order_relaxed);
+}
+
+RkUint64 Scheduler::GetDeterministicSeed() const noexcept
+{
+    return m_deterministic_seed.load(std::memory_order_relaxed);
+}
+
+SchedulerStatistics Scheduler::GetStatistics() const noexcept
+{
+    SchedulerStatistics statistics {};
+
+    statistics.elapsed_time = WorkerCounters::GetTimestamp() - m_statistics_start.load(std::memory_order_relaxed);
+    statistics.workers.resize(m_workers.size() + 1ULL);
+
+    RkFloat queue_depth_sum = 0.0F;
+    for (RkSize index = 0ULL; index < statistics.workers.size(); ++index)
+    {
+        WorkerStatistics& worker = statistics.workers[index];
+
+        m_counters[index].Collect(statistics.elapsed_time, worker, statistics.latency_histogram);
+
+        statistics.jobs_executed  += worker.jobs_executed;
+        statistics.max_queue_depth = std::max(statistics.max_queue_depth, worker.max_queue_depth);
+        queue_depth_sum           += worker.average_queue_depth * static_cast<RkFloat>(worker.jobs_executed);
+
+        // Threads outside of the scheduler aren't dedicated to the scheduler, their utilization is meaningless
+        if (index < m_workers.size())
+            statistics.utilization += worker.utilization / static_cast<RkFloat>(m_workers.size());
+    }
+
+    if (statistics.jobs_executed > 0ULL)
+        statistics.average_queue_depth = queue_depth_sum / static_cast<RkFloat>(statistics.jobs_executed);
+
+    // Percentiles are approximated by the upper bound of their bucket
+    RkUint64 cumulated_count = 0ULL;
+    for (RkSize bucket = 0ULL; bucket < scheduler_latency_buckets_count; ++bucket)
+    {
+        cumulated_count += statistics.latency_histogram[bucket];
+
+        if (statistics.median_latency == 0ULL && cumulated_count * 2ULL >= statistics.jobs_executed)
+            statistics.median_latency = 1ULL << bucket;
+
+        if (statistics.p99_latency == 0ULL && cumulated_count * 100ULL >= statistics.jobs_executed * 99ULL)
+            statistics.p99_latency = 1ULL << bucket;
+    }
+
+    return statistics;
+}
+
+RkVoid Scheduler::ResetStatistics() noexcept
+{
+    for (RkSize index = 0ULL; index <= m_workers.size(); ++index)
+        m_counters[index].Reset();
+
+    m_statistics_start.store(WorkerCounters::GetTimestamp(), std::memory_order_relaxed);
+}
+
+RkVoid Scheduler::LogStatisticsSummary() const noexcept
+{
+    if (!m_logger)
+        return;
+
+    SchedulerStatistics const statistics = GetStatistics();
+
+    if (statistics.jobs_executed == 0ULL)
+        return;
+
+    m_logger->Info(std::to_string(statistics.jobs_executed) + " jobs executed in "
+                 + std::to_string(statistics.elapsed_time / 1000000ULL) + " ms, workers "
+                 + std::to_string(static_cast<RkSize>(statistics.utilization * 100.0F)) + "% busy, queue depth "
+                 + std::to_string(statistics.average_queue_depth) + " on average ("
+                 + std::to_string(statistics.max_queue_depth) + " max), start latency under "
+                 + std::to_string(statistics.median_latency / 1000ULL) + " us (median) and "
+                 + std::to_string(statistics.p99_latency / 1000ULL) + " us (99th percentile)");
+
+    for (RkSize index = 0ULL; index < statistics.workers.size(); ++index)
+    {
+        WorkerStatistics const& worker = statistics.workers[index];
+
+        m_logger->Debug((index < m_workers.size() ? "Worker " + std::to_string(index) : std::string("Other threads")) + ": "
+                      + std::to_string(worker.jobs_executed) + " jobs, "
+                      + std::to_string(worker.busy_time / 1000000ULL) + " ms busy, "
+                      + std::to_string(worker.idle_time / 1000000ULL) + " ms idle ("
+                      + std::to_string(static_cast<RkSize>(worker.utilization * 100.0F)) + "% busy)");
+    }
+}
+
+RkSize Scheduler::GetNumaNodesCount() const noexcept
+{
+    return m_numa_nodes_count;
+}
+
+RkUint32 Scheduler::GetCurrentNumaNode() const noexcept
+{
+    if (m_current_scheduler != this)
+        return invalid_numa_node;
+
+    return m_workers_numa_node[m_current_worker_index];
+}
+
+CpuTopology const& Scheduler::GetTopology() const noexcept
+{
+    return m_topology;
 }
 
 std::vector<Worker> const& Scheduler::GetWorkers() const noexcept
@@ -83,16 +414,411 @@ std::vector<Worker> const& Scheduler::GetWorkers() const noexcept
     return m_workers;
 }
 
-RkVoid Scheduler::WorkersJob() noexcept
+WorkerCounters& Scheduler::GetCurrentCounters() const noexcept
+{
+    return m_counters[m_current_scheduler == this ? m_current_worker_index : m_workers.size()];
+}
+
+Scheduler::JobsAccounting& Scheduler::GetCurrentAccounting() const noexcept
+{
+    return m_accounting[m_current_scheduler == this ? m_current_worker_index : m_workers.size()];
+}
+
+RkSize Scheduler::GetPendingJobsCount(EJobPriority const in_priority) const noexcept
+{
+    RkSize const priority = static_cast<RkSize>(in_priority);
+
+    // Acquisitions are summed first, every job acquired has been pushed before,
+    // so the pushes summed afterwards always cover them and the result can only be an overestimate
+    RkUint64 acquired_jobs = 0ULL;
+    for (RkSize index = 0ULL; index <= m_workers.size(); ++index)
+        acquired_jobs += m_accounting[index].acquired_jobs[priority].load(std::memory_order_seq_cst);
+
+    RkUint64 pushed_jobs = 0ULL;
+    for (RkSize index = 0ULL; index <= m_workers.size(); ++index)
+        pushed_jobs += m_accounting[index].pushed_jobs[priority].load(std::memory_order_seq_cst);
+
+    return pushed_jobs > acquired_jobs ? static_cast<RkSize>(pushed_jobs - acquired_jobs) : 0ULL;
+}
+
+RkBool Scheduler::MayHaveJobs(EJobPriority const in_priority) const noexcept
+{
+    return m_jobs_hint.may_have_jobs[static_cast<RkSize>(in_priority)].load(std::memory_order_seq_cst);
+}
+
+RkVoid Scheduler::RefreshJobsHint(EJobPriority const in_priority) noexcept
+{
+    std::atomic<RkBool>& hint = m_jobs_hint.may_have_jobs[static_cast<RkSize>(in_priority)];
+
+    // Cleared before counting: a producer counted after the count below sees the hint cleared and sets it again (see PushJob)
+    hint.store(false, std::memory_order_seq_cst);
+
+    if (GetPendingJobsCount(in_priority) == 0ULL)
+        return;
+
+    // Some jobs are still there, a worker could have parked while the hint was cleared
+    hint.store(true, std::memory_order_seq_cst);
+
+    WakeUpWorker();
+}
+
+RkSize Scheduler::GetUnfinishedJobsCount() const noexcept
+{
+    // Same reasoning as GetPendingJobsCount(), completions are summed before the pushes
+    RkUint64 completed_jobs = 0ULL;
+    for (RkSize index = 0ULL; index <= m_workers.size(); ++index)
+        completed_jobs += m_accounting[index].completed_jobs.load(std::memory_order_seq_cst);
+
+    RkUint64 pushed_jobs = 0ULL;
+    for (RkSize index = 0ULL; index <= m_workers.size(); ++index)
+        for (std::atomic<RkUint64> const& pushed: m_accounting[index].pushed_jobs)
+            pushed_jobs += pushed.load(std::memory_order_seq_cst);
+
+    return pushed_jobs > completed_jobs ? static_cast<RkSize>(pushed_jobs - completed_jobs) : 0ULL;
+}
+
+RkVoid Scheduler::WakeUpWorker() noexcept
+{
+    // Parking workers increment this counter before checking for pending jobs (see WaitForJobs)
+    // so either they will see the new job, or we will see them parked.
+    // Spinning workers aren't counted, they will pick up the job on their own without any system call
+    if (m_sleeping_workers_count.load(std::memory_order_seq_cst) == 0ULL)
+        return;
+
+    m_wake_epoch.fetch_add(1U, std::memory_order_seq_cst);
+    m_wake_epoch.notify_one();
+}
+
+RkVoid Scheduler::WaitForJobs() noexcept
+{
+    // Spinning first, a job scheduled shortly after is picked up without any system call on either side
+    RkUint32 const spin_count = m_idle_spin_count.load(std::memory_order_relaxed);
+    for (RkUint32 iteration = 0U; iteration < spin_count; ++iteration)
+    {
+        if (HasAvailableJobs() || !m_running.load(std::memory_order_acquire))
+            return;
+
+        CpuRelax();
+    }
+
+    // Then giving the core away to the other threads, while staying ready to react quickly
+    RkUint32 const yield_count = m_idle_yield_count.load(std::memory_order_relaxed);
+    for (RkUint32 iteration = 0U; iteration < yield_count; ++iteration)
+    {
+        if (HasAvailableJobs() || !m_running.load(std::memory_order_acquire))
+            return;
+
+        std::this_thread::yield();
+    }
+
+    // Finally parking until a producer changes the wake epoch.
+    // The epoch is read before announcing the worker as parked: a producer that didn't see this worker parked
+    // made its job visible to the check below, and any later producer changes the epoch we are waiting on
+    RkUint32 const epoch = m_wake_epoch.load(std::memory_order_seq_cst);
+
+    m_sleeping_workers_count.fetch_add(1ULL, std::memory_order_seq_cst);
+
+    if (!HasAvailableJobs() && m_running.load(std::memory_order_seq_cst))
+    {
+        RUKEN_TRACE_SCOPE("Park", "Scheduler")
+
+        m_wake_epoch.wait(epoch, std::memory_order_seq_cst);
+    }
+
+    m_sleeping_workers_count.fetch_sub(1ULL, std::memory_order_relaxed);
+}
+
+PooledJob* Scheduler::StealJob(RkSize const in_worker_index, EJobPriority const in_priority) noexcept
+{
+    std::vector<std::unique_ptr<JobQueue>>& queues = m_queues[static_cast<RkSize>(in_priority)];
+
+    RkSize const queues_count = queues.size();
+
+    // Xorshift, this only needs to be cheap, not to be good
+    m_random_state ^= m_random_state << 13;
+    m_random_state ^= m_random_state >> 17;
+    m_random_state ^= m_random_state << 5;
+
+    RkUint32 const node = in_worker_index < m_workers.size() ? m_workers_numa_node[in_worker_index] : invalid_numa_node;
+    PooledJob*     job  = nullptr;
+
+    // The workers of the same numa node first, their jobs are the most likely to work on memory close to us
+    if (node != invalid_numa_node)
+    {
+        std::vector<RkSize> const& neighbours   = m_numa_nodes_workers[node];
+        RkSize              const  first_victim = m_random_state % neighbours.size();
+
+        for (RkSize offset = 0ULL; offset < neighbours.size(); ++offset)
+        {
+            RkSize const victim = neighbours[(first_victim + offset) % neighbours.size()];
+
+            if (victim != in_worker_index && queues[victim]->Steal(job))
+                return job;
+        }
+    }
+
+    // Then the workers of the other nodes
+    if (node == invalid_numa_node || m_numa_nodes_count > 1ULL)
+    {
+        RkSize const first_victim = m_random_state % queues_count;
+
+        for (RkSize offset = 0ULL; offset < queues_count; ++offset)
+        {
+            RkSize const victim = (first_victim + offset) % queues_count;
+
+            if (victim != in_worker_index && m_workers_numa_node[victim] != node && queues[victim]->Steal(job))
+                return job;
+        }
+    }
+
+    // Finally the jobs meant for other nodes, these are better executed remotely than not at all
+    std::vector<std::unique_ptr<JobQueue>>& injection_queues = m_injection_queues[static_cast<RkSize>(in_priority)];
+    for (RkSize index = 0ULL; index < m_numa_nodes_count; ++index)
+    {
+        if (index != node && injection_queues[index + 1ULL]->Steal(job))
+            return job;
+    }
+
+    return nullptr;
+}
+
+PooledJob* Scheduler::AcquireJob(RkSize const in_worker_index, EJobPriority const in_priority) noexcept
+{
+    RkSize const priority = static_cast<RkSize>(in_priority);
+
+    PooledJob* job = nullptr;
+
+    // Local jobs first, these are the most likely to be hot in the cache
+    if (in_worker_index >= m_workers.size() || !m_queues[priority][in_worker_index]->Pop(job))
+    {
+        // Nothing to look for, this avoids stealing attempts on every single deque
+        if (!MayHaveJobs(in_priority))
+            return nullptr;
+
+        // Then the jobs scheduled for our numa node and the jobs scheduled from outside of the workers,
+        // and finally, stealing some work from the other workers
+        std::vector<std::unique_ptr<JobQueue>>& injection_queues = m_injection_queues[priority];
+
+        RkBool const has_node_job = in_worker_index < m_workers.size() &&
+                                    injection_queues[m_workers_numa_node[in_worker_index] + 1ULL]->Steal(job);
+
+        if (!has_node_job && !injection_queues.front()->Steal(job))
+            job = StealJob(in_worker_index, in_priority);
+
+        if (!job)
+            RefreshJobsHint(in_priority);
+    }
+
+    // Released, the push of the job must be visible to anyone seeing its acquisition, see GetPendingJobsCount()
+    if (job)
+        GetCurrentAccounting().acquired_jobs[priority].fetch_add(1ULL, std::memory_order_release);
+
+    return job;
+}
+
+RkVoid Scheduler::PushJob(Job&& in_task, CompletionToken* in_token, EJobPriority const in_priority, RkUint32 in_numa_node) noexcept
+{
+    RkSize const priority = static_cast<RkSize>(in_priority);
+
+    // Preferences for unknown nodes are ignored
+    if (in_numa_node >= m_numa_nodes_count)
+        in_numa_node = invalid_numa_node;
+
+    // Counting the job before making it visible, this way a worker can never pick up a job that hasn't been counted.
+    // The counter belongs to the calling thread, the sequential consistency thus costs no cache line transfer
+    GetCurrentAccounting().pushed_jobs[priority].fetch_add(1ULL, std::memory_order_seq_cst);
+
+    RkBool const from_worker = m_current_scheduler == this;
+
+    RkUint64 const enqueue_time = WorkerCounters::GetTimestamp();
+
+    // Workers keep their jobs local, unless these are meant for another numa node
+    if (from_worker && (in_numa_node == invalid_numa_node || in_numa_node == m_workers_numa_node[m_current_worker_index]))
+    {
+        PooledJob* job = m_pools[m_current_worker_index]->Acquire(std::move(in_task), in_token);
+        job->enqueue_time = enqueue_time;
+
+        m_queues[priority][m_current_worker_index]->Push(job);
+    }
+    else
+    {
+        JobQueue& queue = *m_injection_queues[priority][in_numa_node == invalid_numa_node ? 0ULL : in_numa_node + 1ULL];
+
+        std::lock_guard<std::mutex> lock(m_injection_mutex);
+
+        // The pool of a worker is only ever used by the worker itself, the injection pool is protected by the mutex
+        PooledJob* job = (from_worker ? *m_pools[m_current_worker_index] : m_injection_pool).Acquire(std::move(in_task), in_token);
+        job->enqueue_time = enqueue_time;
+
+        queue.Push(job);
+    }
+
+    // The hint is read after counting the job, so either it is still set, or it has been cleared
+    // by a thread that will count this job and set it again, see RefreshJobsHint()
+    std::atomic<RkBool>& hint = m_jobs_hint.may_have_jobs[priority];
+    if (!hint.load(std::memory_order_seq_cst))
+        hint.store(true, std::memory_order_seq_cst);
+
+    WakeUpWorker();
+}
+
+RkVoid Scheduler::ExecuteJob(PooledJob* in_job) noexcept
+{
+    CompletionToken* const token       = in_job->token;
+    RkUint64         const start_time  = WorkerCounters::GetTimestamp();
+    RkUint64         const latency     = start_time - std::min(in_job->enqueue_time, start_time);
+
+    // Only the queues of the calling thread are looked at, summing the pending jobs of every thread would cost a lot more than the job itself
+    RkSize queue_depth = 0ULL;
+    for (RkSize priority = 0ULL; priority < priorities_count; ++priority)
+    {
+        JobQueue const& queue = m_current_scheduler == this ? *m_queues[priority][m_current_worker_index] : *m_injection_queues[priority].front();
+
+        queue_depth += queue.GetSizeEstimate();
+    }
+
+    // Jobs executed from another job (see Wait) are already accounted in the busy time of the outer job
+    RkBool const outer_job = m_job_depth++ == 0ULL;
+
+    {
+        RUKEN_TRACE_SCOPE("Job", "Scheduler")
+
+        in_job->job();
+    }
+
+    --m_job_depth;
+
+    GetCurrentCounters().RecordJob(latency, outer_job ? WorkerCounters::GetTimestamp() - start_time : 0ULL, queue_depth);
+
+    // Releasing the job first, the owner of the token might destroy everything the job refers to once completed
+    JobPool::Release(in_job);
+
+    if (token)
+        token->Complete();
+
+    CompleteJob();
+}
+
+RkVoid Scheduler::DropJob(PooledJob* in_job) noexcept
 {
-    Job current_job;
+    CompletionToken* const token = in_job->token;
+
+    JobPool::Release(in_job);
+
+    if (token)
+        token->Complete();
+
+    CompleteJob();
+}
+
+RkVoid Scheduler::CompleteJob() noexcept
+{
+    GetCurrentAccounting().completed_jobs.fetch_add(1ULL, std::memory_order_seq_cst);
+
+    // Nobody is waiting for every job to be done most of the time, this line is thus almost never written
+    if (m_queued_tasks_waiters.load(std::memory_order_seq_cst) == 0ULL)
+        return;
+
+    m_completion_epoch.fetch_add(1U, std::memory_order_seq_cst);
+    m_completion_epoch.notify_all();
+}
+
+RkBool Scheduler::TryExecuteWaitingJob() noexcept
+{
+    if (TryExecuteJob())
+        return true;
+
+    // A thread waiting from a background job can help with the other background jobs,
+    // otherwise a waiting background job could hold the last background slot and stall its own group
+    if (m_in_background_job && m_current_scheduler == this)
+    {
+        if (PooledJob* job = AcquireJob(m_current_worker_index, EJobPriority::Background))
+        {
+            ExecuteJob(job);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+RkBool Scheduler::AcquireBackgroundSlot() noexcept
+{
+    RkSize count = m_background_workers_count.load(std::memory_order_relaxed);
+
+    while (count < m_max_background_workers)
+    {
+        if (m_background_workers_count.compare_exchange_weak(count, count + 1ULL, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return true;
+    }
+
+    return false;
+}
+
+RkBool Scheduler::HasAvailableJobs() const noexcept
+{
+    // Only the hints are checked, idle workers spin on this and must not pull the accounting of every other worker
+    if (MayHaveJobs(EJobPriority::Critical) || MayHaveJobs(EJobPriority::Normal))
+        return true;
+
+    // Background jobs are only available if there is a background slot left,
+    // otherwise the workers holding the slots will pick them up once done with their current job
+    return MayHaveJobs(EJobPriority::Background) &&
+           m_background_workers_count.load(std::memory_order_seq_cst) < m_max_background_workers;
+}
+
+RkVoid Scheduler::WorkersJob(RkSize const in_worker_index) noexcept
+{
+    m_current_scheduler    = this;
+    m_current_worker_index = in_worker_index;
+    m_random_state         = static_cast<RkUint32>(in_worker_index) * 2654435761U + 1U;
+
+    #if defined(RUKEN_TRACING_ENABLED)
+
+        Tracer::SetCurrentThreadName("Ruken Worker " + std::to_string(in_worker_index));
+
+    #endif
 
     while (m_running.load(std::memory_order_acquire))
     {
-        // Always try to dequeue jobs, the job queue will lock us if nothing is available
-        RkBool const job_validity = m_job_queue.Dequeue(current_job);
+        // No job is running on this worker, the frame memory of the previous frames can be released
+        FrameAllocator::SynchronizeThread();
+
+        // Higher priorities are always drained first
+        PooledJob* job = AcquireJob(in_worker_index, EJobPriority::Critical);
+        if (!job)
+            job = AcquireJob(in_worker_index, EJobPriority::Normal);
+
+        if (job)
+        {
+            ExecuteJob(job);
+            continue;
+        }
+
+        // Then background jobs, as long as there are not too many workers busy with those already
+        if (AcquireBackgroundSlot())
+        {
+            job = AcquireJob(in_worker_index, EJobPriority::Background);
+            if (job)
+            {
+                m_in_background_job = true;
+                ExecuteJob(job);
+                m_in_background_job = false;
+            }
+
+            m_background_workers_count.fetch_sub(1ULL, std::memory_order_seq_cst);
 
-        if (job_validity)
-            current_job();
+            if (job)
+                continue;
+        }
+
+        // Nothing to do, waiting for a new job to be scheduled
+        RkUint64 const idle_start = WorkerCounters::GetTimestamp();
+
+        WaitForJobs();
+
+        m_counters[in_worker_index].RecordIdleTime(WorkerCounters::GetTimestamp() - idle_start);
     }
+
+    m_current_scheduler = nullptr;
 }
@@ -0,0 +1,190 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma region Synchronized
+
+template <typename TType>
+template <typename ...TArgs, typename>
+Synchronized<TType, ESynchronizationPolicy::SeqLock>::Synchronized(TArgs... in_args) noexcept
+{
+    StoreWords(TType(std::forward<TArgs>(in_args)...));
+}
+
+template <typename TType>
+Synchronized<TType, ESynchronizationPolicy::SeqLock>::Synchronized() noexcept
+{
+    StoreWords(TType {});
+}
+
+template <typename TType>
+RkVoid Synchronized<TType, ESynchronizationPolicy::SeqLock>::Load(TType& out_value) const noexcept
+{
+    Words words;
+
+    while (true)
+    {
+        // An odd sequence means that a write is in progress
+        RkUint32 const sequence = m_sequence.load(std::memory_order_acquire);
+        if (sequence & 1U)
+        {
+            CpuRelax();
+            continue;
+        }
+
+        for (RkSize index = 0ULL; index < words_count; ++index)
+            words[index] = m_words[index].load(std::memory_order_relaxed);
+
+        // Making sure the words are read before checking the sequence again
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (m_sequence.load(std::memory_order_relaxed) == sequence)
+            break;
+    }
+
+    std::memcpy(&out_value, words.data(), sizeof(TType));
+}
+
+template <typename TType>
+RkVoid Synchronized<TType, ESynchronizationPolicy::SeqLock>::BeginWrite() noexcept
+{
+    RkUint32 sequence = m_sequence.load(std::memory_order_relaxed);
+
+    // Writers are serialized by making the sequence odd
+    while ((sequence & 1U) || !m_sequence.compare_exchange_weak(sequence, sequence + 1U, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        CpuRelax();
+        sequence = m_sequence.load(std::memory_order_relaxed);
+    }
+
+    // Making sure readers see the odd sequence before any modified word
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+template <typename TType>
+RkVoid Synchronized<TType, ESynchronizationPolicy::SeqLock>::EndWrite(TType const& in_value) noexcept
+{
+    StoreWords(in_value);
+
+    m_sequence.fetch_add(1U, std::memory_order_release);
+}
+
+template <typename TType>
+RkVoid Synchronized<TType, ESynchronizationPolicy::SeqLock>::StoreWords(TType const& in_value) noexcept
+{
+    Words words {};
+    std::memcpy(words.data(), &in_value, sizeof(TType));
+
+    for (RkSize index = 0ULL; index < words_count; ++index)
+        m_words[index].store(words[index], std::memory_order_relaxed);
+}
+
+#pragma endregion
+
+#pragma region Read access
+
+template <class TData, EAccessMode TMode>
+SeqLockAccess<TData, TMode>::SeqLockAccess(Synchronized<TData, ESynchronizationPolicy::SeqLock> const& in_synchronized) noexcept
+{
+    in_synchronized.Load(m_value);
+}
+
+template <class TData, EAccessMode TMode>
+TData const& SeqLockAccess<TData, TMode>::Get() const noexcept
+{
+    return m_value;
+}
+
+template <class TData, EAccessMode TMode>
+TData const& SeqLockAccess<TData, TMode>::operator*() const noexcept
+{
+    return m_value;
+}
+
+template <class TData, EAccessMode TMode>
+TData const* SeqLockAccess<TData, TMode>::operator->() const noexcept
+{
+    return &m_value;
+}
+
+#pragma endregion
+
+#pragma region Write access
+
+template <class TData>
+SeqLockAccess<TData, EAccessMode::Write>::SeqLockAccess(Synchronized<TData, ESynchronizationPolicy::SeqLock>& in_synchronized) noexcept:
+    m_synchronized {in_synchronized}
+{
+    m_synchronized.BeginWrite();
+
+    // No other writer can modify the words at this point, the copy can't be torn
+    typename Synchronized<TData, ESynchronizationPolicy::SeqLock>::Words words;
+    for (RkSize index = 0ULL; index < words.size(); ++index)
+        words[index] = m_synchronized.m_words[index].load(std::memory_order_relaxed);
+
+    std::memcpy(&m_value, words.data(), sizeof(TData));
+}
+
+template <class TData>
+SeqLockAccess<TData, EAccessMode::Write>::~SeqLockAccess() noexcept
+{
+    m_synchronized.EndWrite(m_value);
+}
+
+template <class TData>
+TData& SeqLockAccess<TData, EAccessMode::Write>::Get() noexcept
+{
+    return m_value;
+}
+
+template <class TData>
+TData const& SeqLockAccess<TData, EAccessMode::Write>::Get() const noexcept
+{
+    return m_value;
+}
+
+template <class TData>
+TData& SeqLockAccess<TData, EAccessMode::Write>::operator*() noexcept
+{
+    return m_value;
+}
+
+template <class TData>
+TData const& SeqLockAccess<TData, EAccessMode::Write>::operator*() const noexcept
+{
+    return m_value;
+}
+
+template <class TData>
+TData* SeqLockAccess<TData, EAccessMode::Write>::operator->() noexcept
+{
+    return &m_value;
+}
+
+template <class TData>
+TData const* SeqLockAccess<TData, EAccessMode::Write>::operator->() const noexcept
+{
+    return &m_value;
+}
+
+#pragma endregion
@@ -22,39 +22,39 @@
  *  SOFTWARE.
  */
 
-template <typename TType>
+template <typename TType, ESynchronizationPolicy TPolicy>
 template <typename ...TArgs, typename>
-Synchronized<TType>::Synchronized(TArgs... in_args):
+Synchronized<TType, TPolicy>::Synchronized(TArgs... in_args):
     m_mutex {},
     m_value {std::forward<TArgs>(in_args)...}
 {}
 
-template <typename TType>
-Synchronized<TType>::Synchronized() noexcept:
+template <typename TType, ESynchronizationPolicy TPolicy>
+Synchronized<TType, TPolicy>::Synchronized() noexcept:
     m_mutex {},
     m_value {}
 {}
 
-template <typename TType>
-Synchronized<TType>::Synchronized(Synchronized const& in_copy) noexcept:
+template <typename TType, ESynchronizationPolicy TPolicy>
+Synchronized<TType, TPolicy>::Synchronized(Synchronized const& in_copy) noexcept:
     m_mutex {},
     m_value {in_copy.m_value}
 {}
 
-template <typename TType>
-Synchronized<TType>::Synchronized(Synchronized&& in_move) noexcept:
+template <typename TType, ESynchronizationPolicy TPolicy>
+Synchronized<TType, TPolicy>::Synchronized(Synchronized&& in_move) noexcept:
     m_mutex {},
     m_value {std::forward(in_move.m_value)}
 {}
 
-template <typename TType>
-TType const& Synchronized<TType>::Unsafe() const noexcept
+template <typename TType, ESynchronizationPolicy TPolicy>
+TType const& Synchronized<TType, TPolicy>::Unsafe() const noexcept
 {
     return m_value;
 }
 
-template <typename TType>
-TType& Synchronized<TType>::Unsafe() noexcept
+template <typename TType, ESynchronizationPolicy TPolicy>
+TType& Synchronized<TType, TPolicy>::Unsafe() noexcept
 {
     return m_value;
 }
\ No newline at end of file
@@ -0,0 +1,105 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include "Threading/Task.hpp"
+
+USING_RUKEN_NAMESPACE
+
+#pragma region TaskJoinCounter
+
+std::coroutine_handle<> TaskJoinCounter::Arrive() noexcept
+{
+    if (remaining.fetch_sub(1ULL, std::memory_order_acq_rel) == 1ULL)
+        return continuation;
+
+    return std::noop_coroutine();
+}
+
+#pragma endregion
+
+#pragma region TaskPromiseBase
+
+RkBool TaskPromiseBase::FinalAwaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+std::coroutine_handle<> TaskPromiseBase::FinalAwaiter::await_suspend(std::coroutine_handle<> const in_handle) const noexcept
+{
+    if (promise.m_join_counter)
+        return promise.m_join_counter->Arrive();
+
+    if (promise.m_continuation)
+        return promise.m_continuation;
+
+    // Nothing will ever look at the result of a detached task
+    if (promise.m_detached)
+        in_handle.destroy();
+
+    return std::noop_coroutine();
+}
+
+RkVoid TaskPromiseBase::FinalAwaiter::await_resume() const noexcept
+{}
+
+std::suspend_always TaskPromiseBase::initial_suspend() const noexcept
+{
+    return {};
+}
+
+TaskPromiseBase::FinalAwaiter TaskPromiseBase::final_suspend() noexcept
+{
+    return FinalAwaiter {*this};
+}
+
+RkVoid TaskPromiseBase::unhandled_exception() noexcept
+{
+    if (m_detached)
+        std::terminate();
+
+    m_exception = std::current_exception();
+}
+
+RkVoid TaskPromiseBase::SetContinuation(std::coroutine_handle<> const in_continuation) noexcept
+{
+    m_continuation = in_continuation;
+}
+
+RkVoid TaskPromiseBase::SetJoinCounter(TaskJoinCounter* const in_join_counter) noexcept
+{
+    m_join_counter = in_join_counter;
+}
+
+RkVoid TaskPromiseBase::SetDetached() noexcept
+{
+    m_detached = true;
+}
+
+RkVoid TaskPromiseBase::RethrowException() const
+{
+    if (m_exception)
+        std::rethrow_exception(m_exception);
+}
+
+#pragma endregion
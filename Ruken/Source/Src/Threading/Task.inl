@@ -0,0 +1,219 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma region TaskPromise
+
+template <typename TResult>
+Task<TResult> TaskPromise<TResult>::get_return_object() noexcept
+{
+    return Task<TResult>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+template <typename TResult>
+template <typename TValue> requires std::convertible_to<TValue&&, TResult>
+RkVoid TaskPromise<TResult>::return_value(TValue&& in_value) noexcept(std::is_nothrow_constructible_v<TResult, TValue&&>)
+{
+    m_result.emplace(std::forward<TValue>(in_value));
+}
+
+template <typename TResult>
+TResult TaskPromise<TResult>::TakeResult()
+{
+    RethrowException();
+
+    return std::move(*m_result);
+}
+
+inline Task<RkVoid> TaskPromise<RkVoid>::get_return_object() noexcept
+{
+    return Task<RkVoid>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+inline RkVoid TaskPromise<RkVoid>::return_void() const noexcept
+{}
+
+inline RkVoid TaskPromise<RkVoid>::TakeResult() const
+{
+    RethrowException();
+}
+
+#pragma endregion
+
+#pragma region Task
+
+template <typename TResult>
+RkBool Task<TResult>::Awaiter::await_ready() const noexcept
+{
+    return handle.done();
+}
+
+template <typename TResult>
+std::coroutine_handle<> Task<TResult>::Awaiter::await_suspend(std::coroutine_handle<> const in_awaiting) const noexcept
+{
+    // Symmetric transfer, starting the task right away on this thread
+    handle.promise().SetContinuation(in_awaiting);
+
+    return handle;
+}
+
+template <typename TResult>
+TResult Task<TResult>::Awaiter::await_resume() const
+{
+    return handle.promise().TakeResult();
+}
+
+template <typename TResult>
+Task<TResult>::Task(std::coroutine_handle<promise_type> const in_handle) noexcept:
+    m_handle {in_handle}
+{}
+
+template <typename TResult>
+Task<TResult>::Task(Task&& in_move) noexcept:
+    m_handle {std::exchange(in_move.m_handle, nullptr)}
+{}
+
+template <typename TResult>
+Task<TResult>::~Task()
+{
+    if (m_handle)
+        m_handle.destroy();
+}
+
+template <typename TResult>
+RkVoid Task<TResult>::Detach() noexcept
+{
+    if (!m_handle)
+        return;
+
+    std::coroutine_handle<promise_type> const handle = std::exchange(m_handle, nullptr);
+
+    handle.promise().SetDetached();
+    handle.resume();
+}
+
+template <typename TResult>
+RkVoid Task<TResult>::Join(TaskJoinCounter& in_join_counter) noexcept
+{
+    if (!m_handle || m_handle.done())
+    {
+        // Cannot be the last arrival, the awaiter of the WhenAll() holds one more count
+        (RkVoid) in_join_counter.Arrive();
+        return;
+    }
+
+    m_handle.promise().SetJoinCounter(&in_join_counter);
+    m_handle.resume();
+}
+
+template <typename TResult>
+RkBool Task<TResult>::Done() const noexcept
+{
+    return m_handle && m_handle.done();
+}
+
+template <typename TResult>
+Task<TResult>& Task<TResult>::operator=(Task&& in_move) noexcept
+{
+    if (this != &in_move)
+    {
+        if (m_handle)
+            m_handle.destroy();
+
+        m_handle = std::exchange(in_move.m_handle, nullptr);
+    }
+
+    return *this;
+}
+
+template <typename TResult>
+typename Task<TResult>::Awaiter Task<TResult>::operator co_await() const noexcept
+{
+    // An empty task has no result to resume with
+    RUKEN_ASSERT_MESSAGE(static_cast<RkBool>(m_handle), "Cannot await an empty (default constructed or moved from) task");
+
+    return Awaiter {m_handle};
+}
+
+#pragma endregion
+
+#pragma region WhenAll
+
+template <typename TTasks>
+WhenAllAwaiter<TTasks>::WhenAllAwaiter(TTasks in_tasks) noexcept:
+    m_tasks {in_tasks}
+{}
+
+template <typename TTasks>
+template <typename TCallback>
+RkVoid WhenAllAwaiter<TTasks>::ForEachTask(TCallback&& in_callback) noexcept
+{
+    if constexpr (requires { std::tuple_size<std::remove_cvref_t<TTasks>>::value; })
+        std::apply([&](auto&... in_tasks) { (in_callback(in_tasks), ...); }, m_tasks);
+    else
+    {
+        for (auto& task: m_tasks)
+            in_callback(task);
+    }
+}
+
+template <typename TTasks>
+RkBool WhenAllAwaiter<TTasks>::await_ready() const noexcept
+{
+    return false;
+}
+
+template <typename TTasks>
+RkBool WhenAllAwaiter<TTasks>::await_suspend(std::coroutine_handle<> const in_awaiting) noexcept
+{
+    RkSize tasks_count = 0ULL;
+    ForEachTask([&](auto&) { ++tasks_count; });
+
+    // One more count is held while starting the tasks, this way the awaiting coroutine
+    // cannot be resumed by a task before being fully suspended
+    m_join_counter.continuation = in_awaiting;
+    m_join_counter.remaining.store(tasks_count + 1ULL, std::memory_order_relaxed);
+
+    ForEachTask([&](auto& in_task) { in_task.Join(m_join_counter); });
+
+    // If every task already completed, there is no need to suspend
+    return m_join_counter.remaining.fetch_sub(1ULL, std::memory_order_acq_rel) != 1ULL;
+}
+
+template <typename TTasks>
+RkVoid WhenAllAwaiter<TTasks>::await_resume() const noexcept
+{}
+
+template <typename... TResults>
+WhenAllAwaiter<std::tuple<Task<TResults>&...>> WhenAll(Task<TResults>&... in_tasks) noexcept
+{
+    return WhenAllAwaiter<std::tuple<Task<TResults>&...>>(std::tie(in_tasks...));
+}
+
+template <typename TResult>
+WhenAllAwaiter<std::vector<Task<TResult>>&> WhenAll(std::vector<Task<TResult>>& in_tasks) noexcept
+{
+    return WhenAllAwaiter<std::vector<Task<TResult>>&>(in_tasks);
+}
+
+#pragma endregion
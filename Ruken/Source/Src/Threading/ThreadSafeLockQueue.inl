@@ -42,7 +42,13 @@ RkVoid ThreadSafeLockQueue<TType>::Enqueue(TType&& in_item) noexcept
 {
     {
         QueueWriteAccess access(m_queue);
-        access->push(in_item);
+        access->push(std::forward<TType>(in_item));
+    }
+
+    // Taking the push mutex makes sure a consumer can't miss the notification
+    // between the check of its wait predicate and the actual wait
+    {
+        std::lock_guard<std::mutex> push_lock(m_push_mutex);
     }
 
     m_push_notification.notify_one();
@@ -51,35 +57,42 @@ RkVoid ThreadSafeLockQueue<TType>::Enqueue(TType&& in_item) noexcept
 template<typename TType>
 RkBool ThreadSafeLockQueue<TType>::Dequeue(TType& out_item) noexcept
 {
-    // If the queue is empty waiting for a new data to be queued
+    while (true)
     {
-        std::unique_lock<std::mutex> push_lock(m_push_mutex);
+        // If the queue is empty waiting for a new data to be queued
+        {
+            std::unique_lock<std::mutex> push_lock(m_push_mutex);
 
-        m_push_notification.wait(push_lock, [&] {
-            return !Empty() || m_unlock_all.load(std::memory_order_acquire);
-        });
-    }
+            m_push_notification.wait(push_lock, [&] {
+                return !Empty() || m_unlock_all.load(std::memory_order_acquire);
+            });
+        }
 
-    // If the wait above has been interrupted by the release() method and the queue is empty, returning here.
-    if (m_unlock_all.load(std::memory_order_acquire))
-    {
-        if (Empty())
-            m_empty_notification.notify_all();
+        // If the wait above has been interrupted by the release() method and the queue is empty, returning here.
+        if (m_unlock_all.load(std::memory_order_acquire))
+        {
+            if (Empty())
+                m_empty_notification.notify_all();
 
-        return false;
-    }
+            return false;
+        }
 
-    QueueWriteAccess access(m_queue);
+        QueueWriteAccess access(m_queue);
 
-    // Popping a new data
-    out_item = access->front();
-    access->pop();
+        // Another consumer might have popped the data since the wait, waiting again
+        if (access->empty())
+            continue;
 
-    // If the queue is empty, notifying the waitUntilEmpty() method
-    if (access->empty())
-        m_empty_notification.notify_all();
+        // Popping a new data
+        out_item = std::move(access->front());
+        access->pop();
 
-    return true;
+        // If the queue is empty, notifying the waitUntilEmpty() method
+        if (access->empty())
+            m_empty_notification.notify_all();
+
+        return true;
+    }
 }
 
 template<typename TType>
@@ -0,0 +1,163 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#pragma region Buffer
+
+template <typename TType>
+WorkStealingDeque<TType>::Buffer::Buffer(RkInt64 const in_capacity) noexcept:
+    capacity {in_capacity},
+    mask     {in_capacity - 1LL},
+    items    {std::make_unique<std::atomic<TType>[]>(static_cast<RkSize>(in_capacity))}
+{ }
+
+template <typename TType>
+TType WorkStealingDeque<TType>::Buffer::Load(RkInt64 const in_index) const noexcept
+{
+    return items[in_index & mask].load(std::memory_order_relaxed);
+}
+
+template <typename TType>
+RkVoid WorkStealingDeque<TType>::Buffer::Store(RkInt64 const in_index, TType in_item) noexcept
+{
+    items[in_index & mask].store(in_item, std::memory_order_relaxed);
+}
+
+#pragma endregion
+
+#pragma region Constructors
+
+template <typename TType>
+WorkStealingDeque<TType>::WorkStealingDeque(RkSize const in_capacity) noexcept
+{
+    RkInt64 capacity = 1LL;
+    while (capacity < static_cast<RkInt64>(in_capacity))
+        capacity <<= 1;
+
+    m_buffers.emplace_back(std::make_unique<Buffer>(capacity));
+    m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+}
+
+#pragma endregion
+
+#pragma region Methods
+
+template <typename TType>
+typename WorkStealingDeque<TType>::Buffer* WorkStealingDeque<TType>::Grow(RkInt64 const in_top, RkInt64 const in_bottom) noexcept
+{
+    Buffer const* old_buffer = m_buffer.load(std::memory_order_relaxed);
+    Buffer*       new_buffer = m_buffers.emplace_back(std::make_unique<Buffer>(old_buffer->capacity * 2LL)).get();
+
+    for (RkInt64 index = in_top; index < in_bottom; ++index)
+        new_buffer->Store(index, old_buffer->Load(index));
+
+    m_buffer.store(new_buffer, std::memory_order_release);
+
+    return new_buffer;
+}
+
+template <typename TType>
+RkVoid WorkStealingDeque<TType>::Push(TType in_item) noexcept
+{
+    RkInt64 const bottom = m_bottom.load(std::memory_order_relaxed);
+    RkInt64 const top    = m_top   .load(std::memory_order_acquire);
+    Buffer*       buffer = m_buffer.load(std::memory_order_relaxed);
+
+    if (bottom - top > buffer->capacity - 1LL)
+        buffer = Grow(top, bottom);
+
+    buffer->Store(bottom, in_item);
+
+    // Publishes the item to the thieves
+    m_bottom.store(bottom + 1LL, std::memory_order_release);
+}
+
+template <typename TType>
+RkBool WorkStealingDeque<TType>::Pop(TType& out_item) noexcept
+{
+    RkInt64 const bottom = m_bottom.load(std::memory_order_relaxed) - 1LL;
+    Buffer*       buffer = m_buffer.load(std::memory_order_relaxed);
+
+    // Reserving the bottom item before looking at the top
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    RkInt64 top = m_top.load(std::memory_order_relaxed);
+
+    // The deque was empty
+    if (top > bottom)
+    {
+        m_bottom.store(bottom + 1LL, std::memory_order_relaxed);
+        return false;
+    }
+
+    TType const item = buffer->Load(bottom);
+
+    // Last item, racing against the thieves for it
+    if (top == bottom)
+    {
+        RkBool const won = m_top.compare_exchange_strong(top, top + 1LL, std::memory_order_seq_cst, std::memory_order_relaxed);
+
+        m_bottom.store(bottom + 1LL, std::memory_order_relaxed);
+
+        if (!won)
+            return false;
+    }
+
+    out_item = item;
+
+    return true;
+}
+
+template <typename TType>
+RkBool WorkStealingDeque<TType>::Steal(TType& out_item) noexcept
+{
+    RkInt64 top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    RkInt64 const bottom = m_bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom)
+        return false;
+
+    Buffer const* buffer = m_buffer.load(std::memory_order_acquire);
+    TType const   item   = buffer->Load(top);
+
+    // Another thief or the owner took the item first
+    if (!m_top.compare_exchange_strong(top, top + 1LL, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return false;
+
+    out_item = item;
+
+    return true;
+}
+
+template <typename TType>
+RkSize WorkStealingDeque<TType>::GetSizeEstimate() const noexcept
+{
+    RkInt64 const bottom = m_bottom.load(std::memory_order_relaxed);
+    RkInt64 const top    = m_top   .load(std::memory_order_relaxed);
+
+    return bottom > top ? static_cast<RkSize>(bottom - top) : 0ULL;
+}
+
+#pragma endregion
@@ -22,8 +22,16 @@
  *  SOFTWARE.
  */
 
+#include "Build/OperatingSystem.hpp"
 #include "Threading/Worker.hpp"
 
+#if defined(RUKEN_OS_WINDOWS)
+    #include "Utility/WindowsOS.hpp"
+#elif defined(RUKEN_OS_LINUX)
+    #include <sched.h>
+    #include <pthread.h>
+#endif
+
 USING_RUKEN_NAMESPACE
 
 Worker::~Worker() noexcept
@@ -58,3 +66,57 @@ std::thread::id Worker::ID() const noexcept
 {
     return m_thread.get_id();
 }
+
+RkBool Worker::SetAffinity(LogicalProcessor const& in_processor) noexcept
+{
+    if (!m_thread.joinable())
+        return false;
+
+    #if defined(RUKEN_OS_WINDOWS)
+
+        GROUP_AFFINITY affinity {};
+        affinity.Group = in_processor.group;
+        affinity.Mask  = KAFFINITY {1} << in_processor.number;
+
+        return SetThreadGroupAffinity(m_thread.native_handle(), &affinity, nullptr) != 0;
+
+    #elif defined(RUKEN_OS_LINUX)
+
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(in_processor.number, &cpus);
+
+        return pthread_setaffinity_np(m_thread.native_handle(), sizeof(cpus), &cpus) == 0;
+
+    #else
+
+        (RkVoid)in_processor;
+        return false;
+
+    #endif
+}
+
+RkBool Worker::SetName(std::string const& in_name) noexcept
+{
+    if (!m_thread.joinable())
+        return false;
+
+    #if defined(RUKEN_OS_WINDOWS)
+
+        // Thread names are only ever made of ascii characters here
+        std::wstring const name(in_name.cbegin(), in_name.cend());
+
+        return SUCCEEDED(SetThreadDescription(m_thread.native_handle(), name.c_str()));
+
+    #elif defined(RUKEN_OS_LINUX)
+
+        // Linux limits thread names to 16 characters, null terminator included
+        return pthread_setname_np(m_thread.native_handle(), in_name.substr(0ULL, 15ULL).c_str()) == 0;
+
+    #else
+
+        (RkVoid)in_name;
+        return false;
+
+    #endif
+}
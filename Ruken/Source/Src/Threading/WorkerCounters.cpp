@@ -0,0 +1,86 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <bit>
+#include <chrono>
+#include <algorithm>
+
+#include "Threading/WorkerCounters.hpp"
+
+USING_RUKEN_NAMESPACE
+
+RkUint64 WorkerCounters::GetTimestamp() noexcept
+{
+    return static_cast<RkUint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+RkVoid WorkerCounters::RecordJob(RkUint64 const in_latency, RkUint64 const in_duration, RkUint64 const in_queue_depth) noexcept
+{
+    RkSize const bucket = std::min<RkSize>(std::bit_width(in_latency), scheduler_latency_buckets_count - 1ULL);
+
+    m_jobs_executed  .fetch_add(1ULL,           std::memory_order_relaxed);
+    m_busy_time      .fetch_add(in_duration,    std::memory_order_relaxed);
+    m_queue_depth_sum.fetch_add(in_queue_depth, std::memory_order_relaxed);
+
+    m_latency_histogram[bucket].fetch_add(1ULL, std::memory_order_relaxed);
+
+    // Only the owner of the counters raises the maximum, threads outside of the scheduler might lose a sample
+    if (in_queue_depth > m_max_queue_depth.load(std::memory_order_relaxed))
+        m_max_queue_depth.store(in_queue_depth, std::memory_order_relaxed);
+}
+
+RkVoid WorkerCounters::RecordIdleTime(RkUint64 const in_duration) noexcept
+{
+    m_idle_time.fetch_add(in_duration, std::memory_order_relaxed);
+}
+
+RkVoid WorkerCounters::Collect(RkUint64 const in_elapsed_time, WorkerStatistics& out_statistics, LatencyHistogram& inout_histogram) const noexcept
+{
+    out_statistics.jobs_executed   = m_jobs_executed  .load(std::memory_order_relaxed);
+    out_statistics.busy_time       = m_busy_time      .load(std::memory_order_relaxed);
+    out_statistics.idle_time       = m_idle_time      .load(std::memory_order_relaxed);
+    out_statistics.max_queue_depth = m_max_queue_depth.load(std::memory_order_relaxed);
+
+    if (out_statistics.jobs_executed > 0ULL)
+        out_statistics.average_queue_depth = static_cast<RkFloat>(m_queue_depth_sum.load(std::memory_order_relaxed)) /
+                                             static_cast<RkFloat>(out_statistics.jobs_executed);
+
+    if (in_elapsed_time > 0ULL)
+        out_statistics.utilization = std::min(static_cast<RkFloat>(out_statistics.busy_time) / static_cast<RkFloat>(in_elapsed_time), 1.0F);
+
+    for (RkSize bucket = 0ULL; bucket < scheduler_latency_buckets_count; ++bucket)
+        inout_histogram[bucket] += m_latency_histogram[bucket].load(std::memory_order_relaxed);
+}
+
+RkVoid WorkerCounters::Reset() noexcept
+{
+    m_jobs_executed  .store(0ULL, std::memory_order_relaxed);
+    m_busy_time      .store(0ULL, std::memory_order_relaxed);
+    m_idle_time      .store(0ULL, std::memory_order_relaxed);
+    m_queue_depth_sum.store(0ULL, std::memory_order_relaxed);
+    m_max_queue_depth.store(0ULL, std::memory_order_relaxed);
+
+    for (std::atomic<RkUint64>& bucket: m_latency_histogram)
+        bucket.store(0ULL, std::memory_order_relaxed);
+}
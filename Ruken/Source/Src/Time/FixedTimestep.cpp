@@ -0,0 +1,72 @@
+/*
+ *  MIT License
+ *
+ *  Copyright (c) 2019-2020 Basile Combet, Philippe Yi
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NON INFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ */
+
+#include <cmath>
+#include <algorithm>
+
+#include "Time/FixedTimestep.hpp"
+
+USING_RUKEN_NAMESPACE
+
+FixedTimestep::FixedTimestep(RkDouble const in_fixed_step, RkUint16 const in_max_steps) noexcept:
+    m_accumulator {0.0},
+    m_fixed_step  {in_fixed_step},
+    m_max_steps   {in_max_steps},
+    m_steps_count {0ULL}
+{}
+
+RkUint16 FixedTimestep::Advance(RkDouble const in_elapsed_time) noexcept
+{
+    m_accumulator += std::max(in_elapsed_time, 0.0);
+
+    RkUint16 steps = 0U;
+    while (m_accumulator >= m_fixed_step && steps < m_max_steps)
+    {
+        m_accumulator -= m_fixed_step;
+        ++steps;
+    }
+
+    // Spiral of death, dropping the time we won't be able to catch up with
+    if (m_accumulator >= m_fixed_step)
+        m_accumulator = std::fmod(m_accumulator, m_fixed_step);
+
+    m_steps_count += steps;
+
+    return steps;
+}
+
+RkFloat FixedTimestep::GetInterpolationAlpha() const noexcept
+{
+    return static_cast<RkFloat>(m_accumulator / m_fixed_step);
+}
+
+RkDouble FixedTimestep::GetFixedStep() const noexcept
+{
+    return m_fixed_step;
+}
+
+RkSize FixedTimestep::GetStepsCount() const noexcept
+{
+    return m_steps_count;
+}
@@ -28,8 +28,8 @@
 
 USING_RUKEN_NAMESPACE
 
-Benchmark::Benchmark(const RkChar* in_label, RkUint64 const in_execution_count) noexcept:
-    m_label {in_label},
+Benchmark::Benchmark(std::string in_label, RkUint64 const in_execution_count) noexcept:
+    m_label {std::move(in_label)},
     m_execution_count {in_execution_count},
     m_time  {std::chrono::steady_clock::now()}
 {}
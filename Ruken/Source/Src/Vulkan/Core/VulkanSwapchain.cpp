@@ -62,7 +62,8 @@ VulkanSwapchain::VulkanSwapchain(VulkanPhysicalDevice& in_physical_device,
 
         in_window.on_framebuffer_resized += [this](RkInt32 const in_width, RkInt32 const in_height)
         {
-            RecreateSwapchain(in_width, in_height);
+            // The images might be in use by the render job, recreation is deferred to the next presentation
+            m_requested_extent.store(static_cast<RkUint64>(in_width) << 32ULL | static_cast<RkUint32>(in_height), std::memory_order_release);
         };
     }
 }
@@ -316,6 +317,10 @@ RkVoid VulkanSwapchain::RecreateSwapchain(RkInt32 const in_width, RkInt32 const
 
 RkVoid VulkanSwapchain::Present(RenderFrame& in_frame) noexcept
 {
+    // Only the last requested size matters if the window has been resized several times since the last frame
+    if (RkUint64 const extent = m_requested_extent.exchange(no_requested_extent, std::memory_order_acq_rel); extent != no_requested_extent)
+        RecreateSwapchain(static_cast<RkInt32>(extent >> 32ULL), static_cast<RkInt32>(extent & 0xFFFFFFFFULL));
+
     if (m_image_extent.width  == 0 || m_image_extent.height == 0)
         return;
 
@@ -24,6 +24,7 @@
 
 #include "Vulkan/FencePool.hpp"
 
+#include "Memory/FrameAllocator.hpp"
 
 #include "Vulkan/Utilities/VulkanDebug.hpp"
 #include "Vulkan/Utilities/VulkanLoader.hpp"
@@ -48,7 +49,12 @@ RkBool FencePool::Wait() const noexcept
 {
     std::lock_guard lock(m_mutex);
 
-    std::vector<VkFence> handles(m_fences.size());
+    // Waiting on an empty set of fences is not valid
+    if (m_fences.empty())
+        return true;
+
+    std::pmr::vector<VkFence> handles(FrameAllocator::GetResource());
+    handles.reserve(m_fences.size());
 
     for (auto const& fence : m_fences)
         handles.emplace_back(fence.GetHandle());
@@ -64,12 +70,13 @@ RkBool FencePool::Reset() noexcept
     {
         std::lock_guard lock(m_mutex);
 
-        std::vector<VkFence> handles(m_fences.size());
+        std::pmr::vector<VkFence> handles(FrameAllocator::GetResource());
+        handles.reserve(m_fences.size());
 
         for (auto const& fence : m_fences)
             handles.emplace_back(fence.GetHandle());
 
-        if (VK_CHECK(vkResetFences(VulkanLoader::GetLoadedDevice(), static_cast<RkUint32>(handles.size()), handles.data())))
+        if (!handles.empty() && VK_CHECK(vkResetFences(VulkanLoader::GetLoadedDevice(), static_cast<RkUint32>(handles.size()), handles.data())))
             return false;
     }
 
@@ -39,6 +39,13 @@ RkVoid Material::Load(ResourceManager& in_manager, ResourceLoadingDescriptor con
     // NotImplementedException
 }
 
+ResourceLoadingDescriptor const& Material::KeepLoadingDescriptor(ResourceLoadingDescriptor const& in_descriptor) noexcept
+{
+    m_loading_descriptor = reinterpret_cast<MaterialLoadingDescriptor const&>(in_descriptor);
+
+    return *m_loading_descriptor;
+}
+
 RkVoid Material::Reload(ResourceManager& in_manager)
 {
     // NotImplementedException
@@ -171,6 +171,13 @@ RkVoid Mesh::Load(ResourceManager& in_manager, ResourceLoadingDescriptor const&
     VulkanDebug::SetObjectName(VK_OBJECT_TYPE_BUFFER, reinterpret_cast<RkUint64>(m_index_buffer ->GetHandle()), "");
 }
 
+ResourceLoadingDescriptor const& Mesh::KeepLoadingDescriptor(ResourceLoadingDescriptor const& in_descriptor) noexcept
+{
+    m_loading_descriptor = reinterpret_cast<MeshLoadingDescriptor const&>(in_descriptor);
+
+    return *m_loading_descriptor;
+}
+
 RkVoid Mesh::Reload(ResourceManager& in_manager)
 {
     auto const& device    = m_loading_descriptor->renderer.get().GetDevice();
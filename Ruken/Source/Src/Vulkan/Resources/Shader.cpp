@@ -45,6 +45,13 @@ RkVoid Shader::Load(ResourceManager& in_manager, ResourceLoadingDescriptor const
     // NotImplementedException
 }
 
+ResourceLoadingDescriptor const& Shader::KeepLoadingDescriptor(ResourceLoadingDescriptor const& in_descriptor) noexcept
+{
+    m_loading_descriptor = reinterpret_cast<ShaderLoadingDescriptor const&>(in_descriptor);
+
+    return *m_loading_descriptor;
+}
+
 RkVoid Shader::Reload(ResourceManager& in_manager)
 {
     // NotImplementedException
@@ -22,6 +22,8 @@
  *  SOFTWARE.
  */
 
+#include <memory>
+
 #pragma warning (push, 0)
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -173,6 +175,48 @@ RkVoid Texture::Load(ResourceManager& in_manager, ResourceLoadingDescriptor cons
     UploadData(device, allocator, pixels, width * height * comp);
 }
 
+RkChar const* Texture::GetSourcePath() const noexcept
+{
+    return m_loading_descriptor ? m_loading_descriptor->path : nullptr;
+}
+
+RkVoid Texture::LoadFromSource(ResourceManager& in_manager, std::optional<std::span<RkByte const>> const in_source)
+{
+    // The source could not be read, stb will report the error itself
+    if (!in_source)
+        return Load(in_manager, *m_loading_descriptor);
+
+    auto const& device    = m_loading_descriptor->renderer.get().GetDevice();
+    auto const& allocator = m_loading_descriptor->renderer.get().GetDeviceAllocator();
+
+    auto width  = 0;
+    auto height = 0;
+    auto comp   = 0;
+
+    // The pixels are always expanded to RGBA, whatever the number of components of the source is
+    std::unique_ptr<stbi_uc, decltype(&stbi_image_free)> pixels {
+        stbi_load_from_memory(in_source->data(), static_cast<RkInt32>(in_source->size()), &width, &height, &comp, STBI_rgb_alpha),
+        &stbi_image_free
+    };
+
+    if (!pixels)
+        throw ResourceProcessingFailure(EResourceProcessingFailureCode::CorruptedResource);
+
+    m_image = CreateImage(allocator, width, height);
+
+    if (!m_image)
+        throw ResourceProcessingFailure(EResourceProcessingFailureCode::Other);
+
+    UploadData(device, allocator, pixels.get(), static_cast<RkUint64>(width) * height * STBI_rgb_alpha);
+}
+
+ResourceLoadingDescriptor const& Texture::KeepLoadingDescriptor(ResourceLoadingDescriptor const& in_descriptor) noexcept
+{
+    m_loading_descriptor = reinterpret_cast<TextureLoadingDescriptor const&>(in_descriptor);
+
+    return *m_loading_descriptor;
+}
+
 RkVoid Texture::Reload(ResourceManager& in_manager)
 {
     auto const& device    = m_loading_descriptor->renderer.get().GetDevice();